@@ -9,5 +9,7 @@ public class FlowSlayer : ModuleRules
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "EnhancedInput", "Niagara", "AnimGraphRuntime", "UMG", "MotionWarping", "NavigationSystem" });
+
+		PrivateDependencyModuleNames.AddRange(new string[] { "Json", "Slate", "SlateCore" });
 	}
 }
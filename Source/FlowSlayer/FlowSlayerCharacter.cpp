@@ -2,7 +2,8 @@
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
-AFlowSlayerCharacter::AFlowSlayerCharacter()
+AFlowSlayerCharacter::AFlowSlayerCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UFSCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = false;
 
@@ -73,6 +74,8 @@ AFlowSlayerCharacter::AFlowSlayerCharacter()
 	CombatComponent->OnHitLanded.AddUniqueDynamic(this, &AFlowSlayerCharacter::HandleOnHitLanded);
 	CombatComponent->OnAttackingStarted.AddUniqueDynamic(DashComponent, &UDashComponent::OnAttackingStarted);
 	CombatComponent->OnAttackingEnded.AddUniqueDynamic(DashComponent, &UDashComponent::OnAttackingEnded);
+	CombatComponent->OnAttackingStarted.AddUniqueDynamic(LockOnComponent, &UFSLockOnComponent::OnAttackingStarted);
+	CombatComponent->OnAttackingEnded.AddUniqueDynamic(LockOnComponent, &UFSLockOnComponent::OnAttackingEnded);
 	OnHitReceived.AddUniqueDynamic(this, &AFlowSlayerCharacter::HandleOnHitReceived);
 
 	InputManagerComponent = CreateDefaultSubobject<UInputManagerComponent>(TEXT("InputManagerComponent"));
@@ -87,13 +90,11 @@ AFlowSlayerCharacter::AFlowSlayerCharacter()
 	InputManagerComponent->OnGuardActionTriggered.BindUObject(this, &AFlowSlayerCharacter::HandleGuardInput);
 	InputManagerComponent->OnHealActionTriggered.BindUObject(this, &AFlowSlayerCharacter::HandleHealInput);
 
+	StatsComponent = CreateDefaultSubobject<UFSStatsComponent>(TEXT("StatsComponent"));
+	checkf(StatsComponent, TEXT("FATAL: StatsComponent is NULL or INVALID !"));
+
 	ProgressionComponent = CreateDefaultSubobject<UProgressionComponent>(TEXT("ProgressionComponent"));
 	checkf(ProgressionComponent, TEXT("FATAL: ProgressionComponent is NULL or INVALID !"));
-	ProgressionComponent->OnUpgradeSelected.AddUniqueDynamic(CombatComponent, &UFSCombatComponent::HandleOnUpgradeSelected);
-	ProgressionComponent->OnUpgradeSelected.AddUniqueDynamic(DashComponent, &UDashComponent::HandleOnUpgradeSelected);
-	ProgressionComponent->OnUpgradeSelected.AddUniqueDynamic(HealthComponent, &UHealthComponent::HandleOnUpgradeSelected);
-	ProgressionComponent->OnUpgradeSelected.AddUniqueDynamic(FlowComponent, &UFSFlowComponent::HandleOnUpgradeSelected);
-	ProgressionComponent->OnUpgradeSelected.AddUniqueDynamic(this, &AFlowSlayerCharacter::HandleOnUpgradeSelected);
 	ProgressionComponent->OnWeaponPartSelected.AddUniqueDynamic(this, &AFlowSlayerCharacter::HandleOnWeaponPartSelected);
 	
 	JumpMaxCount = 2;
@@ -110,10 +111,16 @@ void AFlowSlayerCharacter::BeginPlay()
 	AnimInstance = GetMesh()->GetAnimInstance();
 	checkf(AnimInstance, TEXT("FATAL: AnimInstance is NULL or INVALID !"));
 
+	NotifyContext.Initialize(this);
+
 	InitializeInputActionMap();
 
 	HealthComponent->OnDeath.BindUObject(this, &AFlowSlayerCharacter::HandleOnDeath);
 
+	BaseRunSpeedThreshold = RunSpeedThreshold;
+	BaseSprintSpeedThreshold = SprintSpeedThreshold;
+	StatsComponent->OnStatChanged.AddUObject(this, &AFlowSlayerCharacter::HandleOnStatChanged);
+
 	/** Tag used when other classes trying to avoid direct dependance to this class */
 	Tags.Add("Player");
 
@@ -139,11 +146,29 @@ void AFlowSlayerCharacter::InitializeHUD()
 {
 	APlayerController* playerController{ Cast<APlayerController>(GetController()) };
 
-	if (!HUDWidgetClass || !playerController)
+	if (!playerController)
+		return;
+
+	if (WorldMarkerOverlayClass)
+	{
+		WorldMarkerOverlayInstance = CreateWidget<UFSWorldMarkerOverlay>(playerController, WorldMarkerOverlayClass);
+		if (WorldMarkerOverlayInstance)
+			WorldMarkerOverlayInstance->AddToViewport(-1);
+	}
+
+	HUDModel = NewObject<UFSHUDModel>(this);
+	HUDModel->Initialize(this);
+
+	if (!HUDWidgetClass)
 		return;
 	HUDWidgetInstance = CreateWidget<UUserWidget>(playerController, HUDWidgetClass);
 	if (HUDWidgetInstance)
+	{
+		if (UFSHUDWidget* hudWidget{ Cast<UFSHUDWidget>(HUDWidgetInstance) })
+			hudWidget->SetHUDModel(HUDModel);
+
 		HUDWidgetInstance->AddToViewport();
+	}
 }
 
 bool AFlowSlayerCharacter::CanJumpInternal_Implementation() const
@@ -195,21 +220,15 @@ void AFlowSlayerCharacter::HandleOnWeaponPartSelected(const FWeaponPartData& Wea
 	weapon->EquipPart(WeaponPart.PartType, WeaponPart);
 }
 
-void AFlowSlayerCharacter::HandleOnUpgradeSelected(const FUpgradeData& Upgrade)
+void AFlowSlayerCharacter::HandleOnStatChanged(EUpgradeStat Stat)
 {
-	if (Upgrade.Stat != EUpgradeStat::MoveSpeed)
+	if (Stat != EUpgradeStat::MoveSpeed)
 		return;
 
-	if (Upgrade.ValueType == EUpgradeValueType::Additive)
-	{
-		SprintSpeedThreshold += Upgrade.Value;
-		RunSpeedThreshold += Upgrade.Value;
-	}
-	else
-	{
-		SprintSpeedThreshold *= Upgrade.Value;
-		RunSpeedThreshold *= Upgrade.Value;
-	}
+	// Recomputed from the authored values — the thresholds never accumulate previous modifiers
+	const FStatAggregate* moveSpeed{ StatsComponent->GetAggregate(EUpgradeStat::MoveSpeed) };
+	RunSpeedThreshold = moveSpeed->Apply(BaseRunSpeedThreshold);
+	SprintSpeedThreshold = moveSpeed->Apply(BaseSprintSpeedThreshold);
 
 	// Apply immediately to the current movement state
 	GetCharacterMovement()->MaxWalkSpeed = LockOnComponent->IsLockedOnTarget()
@@ -339,7 +358,7 @@ void AFlowSlayerCharacter::OnAttackInputActionReceived(const UInputAction* input
 	// Handle Light/Heavy standing/running attacks
 	if (inputAction == InputManagerComponent->GetLightAttackAction())
 	{
-		if (GetCharacterMovement()->IsFalling() || GetCharacterMovement()->IsFlying())
+		if (GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
 			attackType = EAttackType::AirCombo;
 
 		else
@@ -348,7 +367,7 @@ void AFlowSlayerCharacter::OnAttackInputActionReceived(const UInputAction* input
 
 	else if (inputAction == InputManagerComponent->GetHeavyAttackAction())
 	{
-		if (GetCharacterMovement()->IsFalling() || GetCharacterMovement()->IsFlying())
+		if (GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
 			attackType = EAttackType::AerialSlam;
 
 		else
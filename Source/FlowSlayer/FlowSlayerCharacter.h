@@ -16,6 +16,8 @@
 #include "EnhancedInputSubsystems.h"
 #include "FSWeapon.h"
 #include "Public/FSDamageable.h"
+#include "Public/FSNotifyContextProvider.h"
+#include "Public/FSCharacterMovementComponent.h"
 #include "Public/FSCombatComponent.h"
 #include "Public/CombatData.h"
 #include "Public/FSLockOnComponent.h"
@@ -24,7 +26,10 @@
 #include "Public/HealthComponent.h"
 #include "Public/InputManagerComponent.h"
 #include "Public/ProgressionComponent.h"
+#include "Public/FSStatsComponent.h"
 #include "Components/WidgetComponent.h"
+#include "Public/FSWorldMarkerOverlay.h"
+#include "Public/FSHUDWidget.h"
 #include "FlowSlayerCharacter.generated.h"
 
 /** Broadcasted when an attack animation cancel window opens and the player inputs a cancel action (dash or jump) */
@@ -36,7 +41,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerDeath, AFlowSlayerCharacter
 DECLARE_LOG_CATEGORY_EXTERN(LogTemplateCharacter, Log, All);
 
 UCLASS(config=Game)
-class FLOWSLAYER_API AFlowSlayerCharacter : public ACharacter, public IFSDamageable
+class FLOWSLAYER_API AFlowSlayerCharacter : public ACharacter, public IFSDamageable, public IFSNotifyContextProvider
 {
 	GENERATED_BODY()
 
@@ -89,6 +94,10 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Progression, meta = (AllowPrivateAccess = "true"))
 	UProgressionComponent* ProgressionComponent;
 
+	/** Stat modifier stacks fed by upgrades and weapon parts — read by every gameplay component */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Progression, meta = (AllowPrivateAccess = "true"))
+	UFSStatsComponent* StatsComponent;
+
 	////////////////////////////////////////////////
 	// CACHED REFERENCES
 	////////////////////////////////////////////////
@@ -101,7 +110,7 @@ private:
 	// UI
 	////////////////////////////////////////////////
 
-	/** Main HUD widget class */
+	/** Main HUD widget class — a UFSHUDWidget subclass receives the HUD model automatically */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI", meta = (AllowPrivateAccess = "true"))
 	TSubclassOf<UUserWidget> HUDWidgetClass;
 
@@ -109,13 +118,29 @@ private:
 	UPROPERTY()
 	UUserWidget* HUDWidgetInstance{ nullptr };
 
+	/** Aggregated HUD values, flushed to the HUD at most once per frame */
+	UPROPERTY()
+	UFSHUDModel* HUDModel{ nullptr };
+
+	/** Components and running state read by the anim notifies of this mesh */
+	FFSNotifyContext NotifyContext;
 
-	/** Spawns and adds the HUD widget to the viewport */
+	/** World marker layer (enemy health bars, lock-on indicator) — drawn below the main HUD */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI", meta = (AllowPrivateAccess = "true"))
+	TSubclassOf<UFSWorldMarkerOverlay> WorldMarkerOverlayClass;
+
+	/** Current world marker layer instance */
+	UPROPERTY()
+	UFSWorldMarkerOverlay* WorldMarkerOverlayInstance{ nullptr };
+
+
+	/** Spawns and adds the HUD widget and the world marker layer to the viewport */
 	void InitializeHUD();
 
 public:
 
-	AFlowSlayerCharacter();
+	/** Swaps the default movement component for UFSCharacterMovementComponent (air juggle mode) */
+	AFlowSlayerCharacter(const FObjectInitializer& ObjectInitializer);
 
 	// --- Lifecycle ---
 
@@ -146,9 +171,15 @@ public:
 	UFSCombatComponent* GetCombatComponent() const { return CombatComponent; }
 	UDashComponent* GetDashComponent() const { return DashComponent; }
 	virtual UHealthComponent* GetHealthComponent() override { return HealthComponent; }
+	virtual FFSNotifyContext& GetNotifyContext() override { return NotifyContext; }
 	UInputManagerComponent* GetInputManagerComponent() const { return InputManagerComponent; }
 	UFSLockOnComponent* GetLockOnComponent() const { return LockOnComponent; }
 	UProgressionComponent* GetProgressionComponent() const { return ProgressionComponent; }
+	UFSStatsComponent* GetStatsComponent() const { return StatsComponent; }
+
+	/** Returns the HUD model — for HUD widgets that do not derive from UFSHUDWidget */
+	UFUNCTION(BlueprintPure, Category = "UI")
+	UFSHUDModel* GetHUDModel() const { return HUDModel; }
 
 	// --- WalkSpeed accessors ---
 
@@ -188,14 +219,21 @@ protected:
 
 	/** Speed at which the character transitions from run to sprint
 	* Also used as MaxWalkSpeed while locked on
+	* MoveSpeed stat applied — recomputed from BaseRunSpeedThreshold when the stat changes
 	*/
 	UPROPERTY(BlueprintReadOnly)
 	float RunSpeedThreshold{ 600.f };
 
-	/** Maximum movement speed of the player */
+	/** Maximum movement speed of the player
+	* MoveSpeed stat applied — recomputed from BaseSprintSpeedThreshold when the stat changes
+	*/
 	UPROPERTY(BlueprintReadOnly)
 	float SprintSpeedThreshold{ 900.f };
 
+	/** Authored thresholds without any MoveSpeed modifier — captured on BeginPlay */
+	float BaseRunSpeedThreshold{ 600.f };
+	float BaseSprintSpeedThreshold{ 900.f };
+
 	// --- IFSDamageable interface ---
 
 	/** Called when this character receives a hit from a melee attack
@@ -231,9 +269,8 @@ private:
 	UFUNCTION()
 	void HandleOnHitLanded(AActor* hitActor, const FVector& hitLocation, const FAttackData& usedAttack);
 
-	/** Applies upgrade effects that concern movement speed (MoveSpeed stat) */
-	UFUNCTION()
-	void HandleOnUpgradeSelected(const FUpgradeData& Upgrade);
+	/** Bound to StatsComponent::OnStatChanged — reapplies the speed thresholds when MoveSpeed changes */
+	void HandleOnStatChanged(EUpgradeStat Stat);
 
 	/** Forwards weapon part selection to the equipped weapon — bound to ProgressionComponent::OnWeaponPartSelected */
 	UFUNCTION()
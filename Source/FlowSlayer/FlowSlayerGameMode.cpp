@@ -14,28 +14,41 @@ void AFlowSlayerGameMode::BeginPlay()
 	PlayerCharacter->GetProgressionComponent()->OnMilestoneLevelUp.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnMilestoneLevelUp);
 	PlayerCharacter->GetInputManagerComponent()->OnPauseActionStarted.BindUObject(this, &AFlowSlayerGameMode::HandleOnPlayerPausePressed);
 
-	TArray<AActor*> foundManagers;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ARunManager::StaticClass(), foundManagers);
-	verifyf(!foundManagers.IsEmpty(), TEXT("[GameMode] No RunManager found in BeginPlay."));
+	// Actors register on their own BeginPlay, which may run before or after ours:
+	// bind to future registrations, then catch up on the ones already there
+	UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() };
+	checkf(registry, TEXT("FATAL: [GameMode] ActorRegistrySubsystem not found in BeginPlay."));
 
-	ARunManager* runManager{ Cast<ARunManager>(foundManagers[0]) };
-	runManager->OnRunCompleted.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnRunCompleted);
+	registry->OnRunManagerRegistered.AddUObject(this, &AFlowSlayerGameMode::HandleOnRunManagerRegistered);
+	registry->OnArenaRegistered.AddUObject(this, &AFlowSlayerGameMode::HandleOnArenaRegistered);
+	registry->OnRewardChestRegistered.AddUObject(this, &AFlowSlayerGameMode::HandleOnRewardChestRegistered);
 
-	TArray<AActor*> foundChests;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ARewardChest::StaticClass(), foundChests);
-	for (AActor* actor : foundChests)
-	{
-		if (ARewardChest* chest{ Cast<ARewardChest>(actor) })
-			chest->OnChestOpened.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnChestOpened);
-	}
+	if (ARunManager* runManager{ registry->GetRunManager() })
+		HandleOnRunManagerRegistered(runManager);
 
-	TArray<AActor*> foundArenas;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), AFSArenaManager::StaticClass(), foundArenas);
-	for (AActor* actor : foundArenas)
-	{
-		if (AFSArenaManager* arena{ Cast<AFSArenaManager>(actor) })
-			arena->OnEnemySpawned.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnEnemySpawned);
-	}
+	for (AFSArenaManager* arena : registry->GetArenas())
+		HandleOnArenaRegistered(arena);
+
+	for (ARewardChest* chest : registry->GetRewardChests())
+		HandleOnRewardChestRegistered(chest);
+}
+
+void AFlowSlayerGameMode::HandleOnRunManagerRegistered(ARunManager* RunManager)
+{
+	if (RunManager)
+		RunManager->OnRunCompleted.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnRunCompleted);
+}
+
+void AFlowSlayerGameMode::HandleOnArenaRegistered(AFSArenaManager* Arena)
+{
+	if (Arena)
+		Arena->OnEnemySpawned.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnEnemySpawned);
+}
+
+void AFlowSlayerGameMode::HandleOnRewardChestRegistered(ARewardChest* Chest)
+{
+	if (Chest)
+		Chest->OnChestOpened.AddUniqueDynamic(this, &AFlowSlayerGameMode::HandleOnChestOpened);
 }
 
 bool AFlowSlayerGameMode::IsScreenActive(UUserWidget* WidgetInstance) const
@@ -98,6 +111,8 @@ void AFlowSlayerGameMode::HandleOnEnemyDeath(AFSEnemy* Enemy)
 	if (!Enemy || !PlayerCharacter)
 		return;
 
+	Enemy->OnEnemyDeath.RemoveDynamic(this, &AFlowSlayerGameMode::HandleOnEnemyDeath);
+
 	UProgressionComponent* progressionComp{ PlayerCharacter->GetProgressionComponent() };
 
 	progressionComp->AddXP(Enemy->GetXPReward());
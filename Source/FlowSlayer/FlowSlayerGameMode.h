@@ -6,6 +6,7 @@
 #include "Public/RunManager.h"
 #include "Public/FSArenaManager.h"
 #include "Public/FSEnemy.h"
+#include "Public/FSActorRegistrySubsystem.h"
 #include "FlowSlayerGameMode.generated.h"
 
 UCLASS(minimalapi)
@@ -86,6 +87,15 @@ protected:
 	UFUNCTION()
 	void HandleOnChestOpened();
 
+	/** Called when the RunManager registers — binds run completion */
+	void HandleOnRunManagerRegistered(ARunManager* RunManager);
+
+	/** Called when an arena registers — binds enemy spawn tracking */
+	void HandleOnArenaRegistered(AFSArenaManager* Arena);
+
+	/** Called when a reward chest registers — binds the reward screen */
+	void HandleOnRewardChestRegistered(ARewardChest* Chest);
+
 	/** Called when an arena spawns an enemy — binds HandleOnEnemyDeath to that enemy's OnEnemyDeath */
 	UFUNCTION()
 	void HandleOnEnemySpawned(AFSEnemy* Enemy);
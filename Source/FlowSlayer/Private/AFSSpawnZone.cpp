@@ -1,4 +1,5 @@
 #include "AFSSpawnZone.h"
+#include "FlowSlayerStats.h"
 
 AAFSSpawnZone::AAFSSpawnZone()
 {
@@ -22,13 +23,39 @@ void AAFSSpawnZone::BeginPlay()
 	checkf(navSystem, TEXT("[SpawnZone] FATAL: Navigation system is NULL or INVALID !"));
 }
 
-AFSEnemy* AAFSSpawnZone::SpawnEnemy()
+void AAFSSpawnZone::GatherSpawnCandidates(TArray<FFSSpawnCandidate>& OutCandidates)
 {
 	if (EnemyPoolSpawn.IsEmpty())
 	{
 		UE_LOG(LogTemp, Error, TEXT("[SpawnZone] EnemyPoolSpawn is empty — assign enemy classes in the editor."));
-		return nullptr;
+		return;
+	}
+
+	// Classes still streaming in are skipped — the arena simply retries on its next spawn attempt
+	for (const TSoftClassPtr<AFSEnemy>& enemyClass : EnemyPoolSpawn)
+	{
+		UClass* loadedClass{ enemyClass.Get() };
+		if (!loadedClass)
+			continue;
+
+		const UFSEnemyArchetype* archetype{ loadedClass->GetDefaultObject<AFSEnemy>()->GetArchetype() };
+		if (!archetype)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[SpawnZone] %s has no Archetype — skipped."), *loadedClass->GetName());
+			continue;
+		}
+
+		OutCandidates.Add({ this, loadedClass, archetype });
 	}
+}
+
+AFSEnemy* AAFSSpawnZone::SpawnEnemy(UClass* EnemyClass)
+{
+	checkf(EnemyClass, TEXT("FATAL: [SpawnZone] SpawnEnemy called without an enemy class."));
+
+	// Spawned into the zone's arena level, not the persistent one — the enemies belong to the arena and go with it
+	FActorSpawnParameters spawnParams;
+	spawnParams.OverrideLevel = GetLevel();
 
 	AFSEnemy* spawnedEnemy{ nullptr };
 	for (CurrentSpawnTries = 0; CurrentSpawnTries < MaxSpawnTries; ++CurrentSpawnTries)
@@ -40,8 +67,9 @@ AFSEnemy* AAFSSpawnZone::SpawnEnemy()
 			return nullptr;
 		}
 
-		int32 randIndex{ FMath::RandRange(0, EnemyPoolSpawn.Num() - 1) };
-		spawnedEnemy = GetWorld()->SpawnActor<AFSEnemy>(EnemyPoolSpawn[randIndex], enemyPosition.GetValue(), {});
+		FS_INC_COUNTER(Spawns);
+		LLM_SCOPE_BYTAG(FlowSlayer_Enemies);
+		spawnedEnemy = GetWorld()->SpawnActor<AFSEnemy>(EnemyClass, enemyPosition.GetValue(), spawnParams);
 
 		if (spawnedEnemy)
 			break;
@@ -58,6 +86,24 @@ AFSEnemy* AAFSSpawnZone::SpawnEnemy()
 	return spawnedEnemy;
 }
 
+void AAFSSpawnZone::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const TSoftClassPtr<AFSEnemy>& enemyClass : EnemyPoolSpawn)
+	{
+		if (!enemyClass.IsNull())
+			OutAssets.AddUnique(enemyClass.ToSoftObjectPath());
+	}
+}
+
+void AAFSSpawnZone::GatherEnemyDependencies(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const TSoftClassPtr<AFSEnemy>& enemyClass : EnemyPoolSpawn)
+	{
+		if (UClass* loadedClass{ enemyClass.Get() })
+			loadedClass->GetDefaultObject<AFSEnemy>()->GatherPreloadAssets(OutAssets);
+	}
+}
+
 TOptional<FTransform> AAFSSpawnZone::GetRandomTransform()
 {
 	FVector origin{ SpawnZoneComponent->GetComponentLocation() };
@@ -7,24 +7,18 @@ UAnimNotifyState_AirStall::UAnimNotifyState_AirStall()
 
 void UAnimNotifyState_AirStall::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	if (!MeshComp)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Movement)
 		return;
 
-	AActor* Owner{ MeshComp->GetOwner() };
-	if (!Owner)
-		return;
-
-	movementCompRef = Owner->FindComponentByClass<UCharacterMovementComponent>();
-	if (!movementCompRef)
-		return;
-
-	movementCompRef->SetMovementMode(EMovementMode::MOVE_Flying);
+	context->Movement->HoldAirJuggle();
 }
 
 void UAnimNotifyState_AirStall::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if (!movementCompRef)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Movement)
 		return;
 
-	movementCompRef->SetMovementMode(EMovementMode::MOVE_Falling);
+	context->Movement->ReleaseAirJuggle();
 }
@@ -9,32 +9,30 @@ void UAnimNotifyState_AnimCancelWindow::NotifyBegin(USkeletalMeshComponent* Mesh
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	if (!MeshComp)
+	FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Player)
 		return;
 
-	AActor* Owner{ MeshComp->GetOwner() };
-	FSCharacter = Cast<AFlowSlayerCharacter>(Owner);
-	if (!FSCharacter)
-		return;
-
-	if (CancelActionTrigger == EAnimCancelWindowActionType::Move)
-		return;
+	context->BeginInstance<FFSAnimCancelInstance>(this);
 }
 
 void UAnimNotifyState_AnimCancelWindow::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 
-	if (!FSCharacter || bAnimCancelTrigger)
+	FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	FFSAnimCancelInstance* cancelWindow{ context ? context->FindInstance<FFSAnimCancelInstance>(this) : nullptr };
+	if (!cancelWindow || cancelWindow->bAnimCancelTrigger)
 		return;
 
+	AFlowSlayerCharacter* FSCharacter{ context->Player };
 	bool bDashCancel{ FSCharacter->GetInputManagerComponent()->GetInputKeyState(EKeys::LeftShift) && FSCharacter->GetInputManagerComponent()->HasMovementInput() && CancelActionTrigger == EAnimCancelWindowActionType::Dash};
 	bool bMoveCancel{ FSCharacter->GetInputManagerComponent()->HasMovementInput() && CancelActionTrigger == EAnimCancelWindowActionType::Move };
 	bool bAnyCancel{ CancelActionTrigger == EAnimCancelWindowActionType::Any && (FSCharacter->GetInputManagerComponent()->GetInputKeyState(EKeys::LeftShift) || FSCharacter->GetInputManagerComponent()->HasMovementInput()) };
 
 	if (bDashCancel || bMoveCancel || bAnyCancel)
 	{
-		bAnimCancelTrigger = true;
+		cancelWindow->bAnimCancelTrigger = true;
 		FSCharacter->OnAnimationCanceled.Broadcast(CancelBlendOutTime);
 	}
 }
@@ -43,5 +41,6 @@ void UAnimNotifyState_AnimCancelWindow::NotifyEnd(USkeletalMeshComponent* MeshCo
 {
 	Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-	bAnimCancelTrigger = false;
-}
\ No newline at end of file
+	if (FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) })
+		context->EndInstance(this);
+}
@@ -7,24 +7,18 @@ UAnimNotifyState_ComboWindow::UAnimNotifyState_ComboWindow()
 
 void UAnimNotifyState_ComboWindow::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	if (!MeshComp)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Combat)
 		return;
 
-	AActor* Owner = MeshComp->GetOwner();
-	if (!Owner)
-		return;
-
-	CombatComp = Owner->FindComponentByClass<UFSCombatComponent>();
-	if (!CombatComp)
-		return;
-
-	CombatComp->OnComboInputWindowOpened.ExecuteIfBound();
+	context->Combat->OnComboInputWindowOpened.ExecuteIfBound();
 }
 
 void UAnimNotifyState_ComboWindow::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if (!CombatComp)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Combat)
 		return;
 
-	CombatComp->OnComboInputWindowClosed.ExecuteIfBound();
+	context->Combat->OnComboInputWindowClosed.ExecuteIfBound();
 }
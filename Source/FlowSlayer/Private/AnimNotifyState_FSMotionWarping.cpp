@@ -1,66 +1,137 @@
 #include "AnimNotifyState_FSMotionWarping.h"
+#include "FlowSlayerStats.h"
+#include "DrawDebugHelpers.h"
+#include "FSCharacterMovementComponent.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 
 void UAnimNotifyState_FSMotionWarping::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
     Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-    PlayerOwner = Cast<ACharacter>(MeshComp->GetOwner());
-    LockOnCompRef = PlayerOwner ? PlayerOwner->GetComponentByClass<UFSLockOnComponent>() : nullptr;
-    MotionWarpingComponent = PlayerOwner ? PlayerOwner->FindComponentByClass<UMotionWarpingComponent>() : nullptr;
-
+    FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
     URootMotionModifier_Warp* warpModifier{ Cast<URootMotionModifier_Warp>(RootMotionModifier) };
-    if (!warpModifier || !LockOnCompRef || !MotionWarpingComponent)
+    if (!warpModifier || !context || !context->LockOn || !context->MotionWarping)
         return;
 
-    const AActor* targetActor{ GetTargetForMotionWarp(SearchRadius, bDebugLines) };
+    const AActor* targetActor{ GetTargetForMotionWarp(*context, SearchRadius, bDebugLines) };
     if (!targetActor)
         return;
 
-    if (attackType == EFSMotionWarpingAttackType::Ground)
-        SetupGroundAttackMotionWarp(warpModifier->WarpTargetName, targetActor, ForwardOffset, bDebugLines);
-    else
-        SetupAirAttackMotionWarp(warpModifier->WarpTargetName, targetActor, ZOffset, ForwardOffset, bDebugLines);
-        
+    // TotalDuration is in montage time — the prediction horizon is in real time
+    float playRate{ 1.f };
+    const UAnimInstance* animInstance{ MeshComp->GetAnimInstance() };
+    const UAnimMontage* montage{ Cast<UAnimMontage>(Animation) };
+    if (animInstance && montage)
+        playRate = FMath::Max(animInstance->Montage_GetPlayRate(montage), KINDA_SMALL_NUMBER);
+
+    FFSMotionWarpInstance& warp{ context->BeginInstance<FFSMotionWarpInstance>(this) };
+    warp.Target = targetActor;
+    warp.WarpTargetName = warpModifier->WarpTargetName;
+    warp.Remaining = TotalDuration / playRate;
+
+    // Air attacks face the enemy right away — the warp then only refines the rotation
+    if (attackType != EFSMotionWarpingAttackType::Ground)
+    {
+        FRotator lookAtRotation{ UKismetMathLibrary::FindLookAtRotation(context->Character->GetActorLocation(), targetActor->GetActorLocation()) };
+        context->Character->SetActorRotation(FRotator(0.f, lookAtRotation.Yaw, 0.f), ETeleportType::TeleportPhysics);
+    }
+
+    UpdateWarpTarget(*context, warp);
+
+    // Suppresses gravity while the warp lifts the owner — the root motion drives the juggle velocity
+    if (attackType == EFSMotionWarpingAttackType::Launcher && context->Movement)
+    {
+        context->Movement->HoldAirJuggle();
+        warp.bHoldingAirJuggle = true;
+    }
+}
+
+void UAnimNotifyState_FSMotionWarping::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+    Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
+
+    if (!bPredictTargetMotion)
+        return;
+
+    FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+    FFSMotionWarpInstance* warp{ context ? context->FindInstance<FFSMotionWarpInstance>(this) : nullptr };
+    if (!warp || !context->MotionWarping)
+        return;
+
+    warp->Remaining = FMath::Max(warp->Remaining - FrameDeltaTime, 0.f);
+    warp->UpdateCooldown -= FrameDeltaTime;
+
+    // Bounded refresh rate — the warp modifier re-solves its curve on every target change
+    if (warp->UpdateCooldown > 0.f || warp->Remaining <= 0.f)
+        return;
+
+    UpdateWarpTarget(*context, *warp);
 }
 
 void UAnimNotifyState_FSMotionWarping::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
     Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-    if (!MotionWarpingComponent)
+    FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+    if (!context || !context->MotionWarping)
         return;
 
-    MotionWarpingComponent->RemoveAllWarpTargets();
+    context->MotionWarping->RemoveAllWarpTargets();
+
+    const FFSMotionWarpInstance* warp{ context->FindInstance<FFSMotionWarpInstance>(this) };
+    if (warp && warp->bHoldingAirJuggle)
+        context->Movement->ReleaseAirJuggle();
 
-    if (!PlayerOwner)
+    context->EndInstance(this);
+}
+
+FVector UAnimNotifyState_FSMotionWarping::PredictTargetLocation(const AActor* targetActor, float predictionTime) const
+{
+    const FVector currentLocation{ targetActor->GetActorLocation() };
+    if (!bPredictTargetMotion)
+        return currentLocation;
+
+    FVector velocity{ targetActor->GetVelocity() };
+    if (attackType == EFSMotionWarpingAttackType::Ground)
+        velocity.Z = 0.0;
+
+    return currentLocation + velocity * FMath::Clamp(predictionTime, 0.f, MaxPredictionTime);
+}
+
+void UAnimNotifyState_FSMotionWarping::UpdateWarpTarget(const FFSNotifyContext& context, FFSMotionWarpInstance& warp) const
+{
+    warp.UpdateCooldown = PredictionUpdateInterval;
+
+    const AActor* targetActor{ warp.Target.Get() };
+    if (!targetActor)
         return;
 
-    EMovementMode currentMovementMode{ PlayerOwner->GetCharacterMovement()->MovementMode };
-    if (attackType == EFSMotionWarpingAttackType::Launcher && currentMovementMode == EMovementMode::MOVE_Flying)
-        PlayerOwner->GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Falling);
+    const FVector enemyLocation{ PredictTargetLocation(targetActor, warp.Remaining) };
+    if (attackType == EFSMotionWarpingAttackType::Ground)
+        SetupGroundAttackMotionWarp(context, warp.WarpTargetName, enemyLocation, ForwardOffset, bDebugLines);
+    else
+        SetupAirAttackMotionWarp(context, warp.WarpTargetName, enemyLocation, ZOffset, ForwardOffset, bDebugLines);
 }
 
-const AActor* UAnimNotifyState_FSMotionWarping::GetTargetForMotionWarp(float searchRadius, bool debugLines)
+const AActor* UAnimNotifyState_FSMotionWarping::GetTargetForMotionWarp(const FFSNotifyContext& context, float searchRadius, bool debugLines) const
 {
-    const AActor* lockedOnTarget{ LockOnCompRef->GetCurrentLockedOnTarget() };
+    const AActor* lockedOnTarget{ context.LockOn->GetCurrentLockedOnTarget() };
 
-    if (lockedOnTarget && (FVector::DistSquared(PlayerOwner->GetActorLocation(), lockedOnTarget->GetActorLocation()) <= FMath::Square(searchRadius)))
+    if (lockedOnTarget && (FVector::DistSquared(context.Character->GetActorLocation(), lockedOnTarget->GetActorLocation()) <= FMath::Square(searchRadius)))
         return lockedOnTarget;
 
     else if (!lockedOnTarget)
-        return GetNearestEnemyFromPlayer(searchRadius, debugLines);
+        return GetNearestEnemyFromPlayer(context, searchRadius, debugLines);
 
     else
         return nullptr;
 }
 
-void UAnimNotifyState_FSMotionWarping::SetupAirAttackMotionWarp(FName motionWarpingTargetName, const AActor* targetActor, float zOffset, float forwardOffset, bool debugLines)
+void UAnimNotifyState_FSMotionWarping::SetupAirAttackMotionWarp(const FFSNotifyContext& context, FName motionWarpingTargetName, const FVector& enemyLocation, float zOffset, float forwardOffset, bool debugLines) const
 {
-    if (!MotionWarpingComponent || !targetActor)
-        return;
-
+    const ACharacter* PlayerOwner{ context.Character };
     FVector playerLocation{ PlayerOwner->GetActorLocation() };
-    FVector enemyLocation{ targetActor->GetActorLocation() };
 
     FVector directionToEnemy{ (enemyLocation - playerLocation).GetSafeNormal() };
 
@@ -75,25 +146,20 @@ void UAnimNotifyState_FSMotionWarping::SetupAirAttackMotionWarp(FName motionWarp
     target.Location = targetLocation;
     target.Rotation = lookAtRotation;
 
-    PlayerOwner->SetActorRotation(FRotator(0.f, lookAtRotation.Yaw, 0.f), ETeleportType::TeleportPhysics);
+    if (debugLines)
+        DrawDebugSphere(PlayerOwner->GetWorld(), targetLocation, 20.f, 8, FColor::Green, false, PredictionUpdateInterval);
 
-    if (attackType == EFSMotionWarpingAttackType::Launcher)
-        PlayerOwner->GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Flying);
-
-    MotionWarpingComponent->AddOrUpdateWarpTarget(target);
+    context.MotionWarping->AddOrUpdateWarpTarget(target);
 }
 
-void UAnimNotifyState_FSMotionWarping::SetupGroundAttackMotionWarp(FName motionWarpingTargetName, const AActor* targetActor, float forwardOffset, bool debugLines)
+void UAnimNotifyState_FSMotionWarping::SetupGroundAttackMotionWarp(const FFSNotifyContext& context, FName motionWarpingTargetName, const FVector& enemyLocation, float forwardOffset, bool debugLines) const
 {
-    if (!MotionWarpingComponent || !targetActor)
-        return;
-    
-    FVector targetLocation{ targetActor->GetActorLocation() };
+    const ACharacter* PlayerOwner{ context.Character };
+    FVector targetLocation{ enemyLocation };
     FVector forwardOffsetVector{ PlayerOwner->GetActorForwardVector() * forwardOffset };
     targetLocation += forwardOffsetVector;
 
     FVector playerLocation{ PlayerOwner->GetActorLocation() };
-    FVector enemyLocation{ targetActor->GetActorLocation() };
     FRotator lookAtRotation{ UKismetMathLibrary::FindLookAtRotation(playerLocation, enemyLocation) };
 
     FMotionWarpingTarget target;
@@ -101,48 +167,28 @@ void UAnimNotifyState_FSMotionWarping::SetupGroundAttackMotionWarp(FName motionW
     target.Location = targetLocation;
     target.Rotation = lookAtRotation;
 
-    MotionWarpingComponent->AddOrUpdateWarpTarget(target);
+    if (debugLines)
+        DrawDebugSphere(PlayerOwner->GetWorld(), targetLocation, 20.f, 8, FColor::Green, false, PredictionUpdateInterval);
+
+    context.MotionWarping->AddOrUpdateWarpTarget(target);
 }
 
-AActor* UAnimNotifyState_FSMotionWarping::GetNearestEnemyFromPlayer(float distanceRadius, bool debugLines) const
+AActor* UAnimNotifyState_FSMotionWarping::GetNearestEnemyFromPlayer(const FFSNotifyContext& context, float distanceRadius, bool debugLines) const
 {
-    FVector Start{ PlayerOwner->GetActorLocation() };
-    FVector End{ Start };
-
-    TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-    ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
-
-    TArray<AActor*> ActorsToIgnore;
-    ActorsToIgnore.Add(PlayerOwner);
-
-    TArray<FHitResult> outHits;
-    bool bHit{ UKismetSystemLibrary::SphereTraceMultiForObjects(
-        PlayerOwner->GetWorld(),
-        Start,
-        End,
-        distanceRadius,
-        ObjectTypes,
-        false,
-        ActorsToIgnore,
-        debugLines ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None,
-        outHits,
-        true
-    ) };
-
-    if (!bHit)
+    const ACharacter* PlayerOwner{ context.Character };
+
+    if (debugLines)
+        DrawDebugSphere(PlayerOwner->GetWorld(), PlayerOwner->GetActorLocation(), distanceRadius, 16, FColor::Red, false, 5.f);
+
+    TArray<AActor*> foundActors;
+    const EFSQueryLatency latency{ bAllowLatentTargetSearch ? EFSQueryLatency::OneFrame : EFSQueryLatency::Immediate };
+    if (!context.LockOn->FindPawnsInRadius(distanceRadius, foundActors, latency))
         return nullptr;
 
-    TSet<AActor*> uniqueHitActors;
     float shortestDistance{ FLT_MAX };
     AActor* nearestEnemy{ nullptr };
-    for (const auto& hit : outHits)
+    for (AActor* hitActor : foundActors)
     {
-        AActor* hitActor{ hit.GetActor() };
-        if (uniqueHitActors.Contains(hitActor))
-            continue;
-
-        uniqueHitActors.Add(hitActor);
-
         if (hitActor->Implements<UFSDamageable>() && !Cast<IFSDamageable>(hitActor)->GetHealthComponent()->IsDead())
         {
             float newDistance{ static_cast<float>(FVector::Distance(hitActor->GetActorLocation(), PlayerOwner->GetActorLocation())) };
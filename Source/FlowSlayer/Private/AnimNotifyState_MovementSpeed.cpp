@@ -10,31 +10,36 @@ void UAnimNotifyState_MovementSpeed::NotifyBegin(USkeletalMeshComponent* MeshCom
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-	OwnerRef = Cast<AFlowSlayerCharacter>(MeshComp->GetOwner());
-	if (!OwnerRef)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Player)
 		return;
 
 	if (bSnapSpeed)
-		OwnerRef->GetCharacterMovement()->MaxWalkSpeed = TargetSpeed;
+		context->Movement->MaxWalkSpeed = TargetSpeed;
 }
 
 void UAnimNotifyState_MovementSpeed::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
 
-	if (bSnapSpeed || !OwnerRef)
+	if (bSnapSpeed)
+		return;
+
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Player)
 		return;
 
-	OwnerRef->GetCharacterMovement()->MaxWalkSpeed = FMath::FInterpTo(OwnerRef->GetCharacterMovement()->MaxWalkSpeed, TargetSpeed, FrameDeltaTime, InterpolationSpeed);
+	context->Movement->MaxWalkSpeed = FMath::FInterpTo(context->Movement->MaxWalkSpeed, TargetSpeed, FrameDeltaTime, InterpolationSpeed);
 }
 
 void UAnimNotifyState_MovementSpeed::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-	if (!OwnerRef)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Player)
 		return;
 
-	OwnerRef->GetCharacterMovement()->MaxWalkSpeed = OwnerRef->GetLockOnComponent()->IsLockedOnTarget() ? OwnerRef->GetRunSpeedThreshold() : OwnerRef->GetSprintSpeedThreshold();
-	OwnerRef = nullptr;
+	const AFlowSlayerCharacter* player{ context->Player };
+	context->Movement->MaxWalkSpeed = context->LockOn->IsLockedOnTarget() ? player->GetRunSpeedThreshold() : player->GetSprintSpeedThreshold();
 }
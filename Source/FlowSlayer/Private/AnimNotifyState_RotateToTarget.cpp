@@ -4,10 +4,12 @@ void UAnimNotifyState_RotateToTarget::NotifyBegin(USkeletalMeshComponent* MeshCo
 	if (!bSnapRotation)
 		return;
 
-	ACharacter* owningCharacter{ Cast<ACharacter>(MeshComp->GetOwner()) };
-	if (!owningCharacter)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Character)
 		return;
 
+	ACharacter* owningCharacter{ context->Character };
+
 	if (bIsEnemy)
 	{
 		APawn* player{ UGameplayStatics::GetPlayerPawn(MeshComp->GetWorld(), 0) };
@@ -28,10 +30,12 @@ void UAnimNotifyState_RotateToTarget::NotifyTick(USkeletalMeshComponent* MeshCom
 	if (bSnapRotation)
 		return;
 
-	ACharacter* owningCharacter{ Cast<ACharacter>(MeshComp->GetOwner()) };
-	if (!owningCharacter)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Character)
 		return;
 
+	ACharacter* owningCharacter{ context->Character };
+
 	FRotator newRotation{ FRotator::ZeroRotator };
 	if (bIsEnemy)
 	{
@@ -1,4 +1,6 @@
 #include "AnimNotifyState_SafeMoveUpdated.h"
+#include "Animation/AnimInstance.h"
+#include "Animation/AnimMontage.h"
 
 UAnimNotifyState_SafeMoveUpdated::UAnimNotifyState_SafeMoveUpdated()
 {
@@ -10,71 +12,28 @@ void UAnimNotifyState_SafeMoveUpdated::NotifyBegin(USkeletalMeshComponent* MeshC
 {
 	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
 
-    OwningCharacter = Cast<ACharacter>(MeshComp->GetOwner());
-	if (!OwningCharacter)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Dash)
 		return;
 
-    DashComp = OwningCharacter->FindComponentByClass<UDashComponent>();
-    if (!DashComp)
-        return;
+	// TotalDuration is in montage time — the component moves in real time
+	float playRate{ 1.f };
+	const UAnimInstance* animInstance{ MeshComp->GetAnimInstance() };
+	const UAnimMontage* montage{ Cast<UAnimMontage>(Animation) };
+	if (animInstance && montage)
+		playRate = FMath::Max(animInstance->Montage_GetPlayRate(montage), KINDA_SMALL_NUMBER);
 
-    if (!MoveCurve)
-        verifyf(MoveCurve, TEXT("MoveCurve is NULL or INVALID !"));
-
-    // Recompute world direction from current camera yaw at the moment movement starts
-    // Avoids stale direction from the ~15 frames between StartDash() and NotifyBegin()
-    FRotator cameraYaw{ 0.f, OwningCharacter->GetControlRotation().Yaw, 0.f };
-    FVector forward{ FRotationMatrix(cameraYaw).GetUnitAxis(EAxis::X) };
-    FVector right{ FRotationMatrix(cameraYaw).GetUnitAxis(EAxis::Y) };
-    FVector2D snappedInput{ DashComp->GetSnappedInput2D() };
-    FVector dashDirection{ (forward * snappedInput.Y + right * snappedInput.X).GetSafeNormal() };
-
-    Start = OwningCharacter->GetActorLocation();
-    End = Start + dashDirection * DashComp->GetDashDistance();
-
-    TimeElapsed = 0.f;
-    LastCurveValue = 0.f;
-    NotifyDuration = TotalDuration;
-}
-
-void UAnimNotifyState_SafeMoveUpdated::NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
-{
-    Super::NotifyTick(MeshComp, Animation, FrameDeltaTime, EventReference);
-
-    if (!OwningCharacter || !MoveCurve || bDashFinished || !DashComp)
-        return;
-
-    TimeElapsed += FrameDeltaTime;
-
-    // Alpha = normalized time progression between 0 and 1
-    float alpha{ FMath::Clamp(TimeElapsed / NotifyDuration, 0.f, 1.f) };
-
-    // The curve transforms linear time into custom movement
-    float curveValue{ MoveCurve->GetFloatValue(alpha) };
-
-    // Delta displacement � only move the difference since last frame
-    // Avoids error accumulation and allows proper collision handling
-    float deltaCurve{ curveValue - LastCurveValue };
-    FVector deltaMove{ (End - Start) * deltaCurve };
-    LastCurveValue = curveValue;
-
-    FHitResult hitResult;
-    OwningCharacter->GetCharacterMovement()->SafeMoveUpdatedComponent(deltaMove, OwningCharacter->GetActorRotation(), true, hitResult);
-
-    if (alpha >= 1.f)
-        bDashFinished = true;
+	context->Dash->BeginDashMove(MoveCurve, TotalDuration / playRate);
 }
 
 void UAnimNotifyState_SafeMoveUpdated::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-    Super::NotifyEnd(MeshComp, Animation, EventReference);
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
 
-    if (DashComp)
-        DashComp->EndDash();
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Dash)
+		return;
 
-    LastCurveValue = 0.f;
-    TimeElapsed = 0.f;
-    bDashFinished = false;
-    OwningCharacter = nullptr;
-    DashComp = nullptr;
+	context->Dash->FinishDashMove();
+	context->Dash->EndDash();
 }
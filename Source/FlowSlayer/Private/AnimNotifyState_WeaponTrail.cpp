@@ -1,4 +1,5 @@
 #include "AnimNotifyState_WeaponTrail.h"
+#include "FlowSlayerStats.h"
 
 UAnimNotifyState_WeaponTrail::UAnimNotifyState_WeaponTrail()
 {
@@ -7,35 +8,18 @@ UAnimNotifyState_WeaponTrail::UAnimNotifyState_WeaponTrail()
 
 void UAnimNotifyState_WeaponTrail::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
-	CombatCompRef = MeshComp->GetOwner()->GetComponentByClass<UFSCombatComponent>();
-	if (!CombatCompRef)
-		return;
-
-	WeaponRef = CombatCompRef->GetEquippedWeapon();
-	if (!WeaponRef)
-		return;
-
-	TrailNiagaraBaseCompRef = WeaponRef->GetTrailNiagaraBaseComponent();
-	TrailNiagaraTipCompRef = WeaponRef->GetTrailNiagaraTipComponent();
-
-	if (TrailNiagaraBaseCompRef && NiagaraTrailSystem)
-	{
-		TrailNiagaraBaseCompRef->SetAsset(NiagaraTrailSystem);
-		TrailNiagaraBaseCompRef->Activate();
-	}
-
-	if (TrailNiagaraTipCompRef && NiagaraTrailSystem)
-	{
-		TrailNiagaraTipCompRef->SetAsset(NiagaraTrailSystem);
-		TrailNiagaraTipCompRef->Activate();
-	}
+	if (AFSWeapon* weapon{ GetEquippedWeapon(MeshComp) })
+		weapon->SetTrailActive(true, NiagaraTrailSystem);
 }
 
 void UAnimNotifyState_WeaponTrail::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
 {
-	if (TrailNiagaraBaseCompRef)
-		TrailNiagaraBaseCompRef->Deactivate();
+	if (AFSWeapon* weapon{ GetEquippedWeapon(MeshComp) })
+		weapon->SetTrailActive(false);
+}
 
-	if (TrailNiagaraTipCompRef)
-		TrailNiagaraTipCompRef->Deactivate();
+AFSWeapon* UAnimNotifyState_WeaponTrail::GetEquippedWeapon(const USkeletalMeshComponent* MeshComp)
+{
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	return context && context->Combat ? context->Combat->GetEquippedWeapon() : nullptr;
 }
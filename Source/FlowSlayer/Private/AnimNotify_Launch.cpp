@@ -9,10 +9,12 @@ void UAnimNotify_Launch::Notify(USkeletalMeshComponent* MeshComp, UAnimSequenceB
 {
 	Super::Notify(MeshComp, Animation, EventReference);
 
-	ACharacter* owningCharacter{ Cast<ACharacter>(MeshComp->GetOwner()) };
-	if (!owningCharacter)
+	const FFSNotifyContext* context{ FFSNotifyContext::Get(MeshComp) };
+	if (!context || !context->Character)
 		return;
 
+	ACharacter* owningCharacter{ context->Character };
+
 	FVector velocity{ VelocityX, VelocityY, VelocityZ };
 	owningCharacter->LaunchCharacter(std::move(velocity), bXYOverride, bZOverride);
 }
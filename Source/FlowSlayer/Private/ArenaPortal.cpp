@@ -31,9 +31,9 @@ void AArenaPortal::OnConstruction(const FTransform& Transform)
 
 	if (GetWorld() && (GetWorld()->WorldType == EWorldType::EditorPreview || GetWorld()->WorldType == EWorldType::Editor))
 	{
-		if (PortalVFX)
+		if (UNiagaraSystem* previewVFX{ PortalVFX.LoadSynchronous() })
 		{
-			NiagaraComponent->SetAsset(PortalVFX);
+			NiagaraComponent->SetAsset(previewVFX);
 			NiagaraComponent->Activate(true);
 		}
 
@@ -60,11 +60,12 @@ void AArenaPortal::ShowPortal()
 	MeshComponent->SetVisibility(true);
 	OverlapBox->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 
-	if (PortalVFX)
-	{
-		NiagaraComponent->SetAsset(PortalVFX);
-		NiagaraComponent->Activate();
-	}
+	if (PortalVFX.Get())
+		ActivatePortalVFX();
+
+	// Preload not finished yet — the portal is usable right away, the VFX pops in once streamed
+	else if (!PortalVFX.IsNull())
+		UAssetManager::GetStreamableManager().RequestAsyncLoad(PortalVFX.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &AArenaPortal::ActivatePortalVFX));
 
 	if (PortalSFX)
 	{
@@ -73,6 +74,22 @@ void AArenaPortal::ShowPortal()
 	}
 }
 
+void AArenaPortal::ActivatePortalVFX()
+{
+	UNiagaraSystem* portalSystem{ PortalVFX.Get() };
+	if (!portalSystem)
+		return;
+
+	NiagaraComponent->SetAsset(portalSystem);
+	NiagaraComponent->Activate();
+}
+
+void AArenaPortal::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	if (!PortalVFX.IsNull())
+		OutAssets.AddUnique(PortalVFX.ToSoftObjectPath());
+}
+
 void AArenaPortal::HandleOnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
 	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
 	bool bFromSweep, const FHitResult& SweepResult)
@@ -81,19 +98,44 @@ void AArenaPortal::HandleOnOverlapBegin(UPrimitiveComponent* OverlappedComponent
 	if (!player)
 		return;
 
+	TeleportRetryFrames = 0;
 	TeleportPlayer(player);
 }
 
 void AArenaPortal::TeleportPlayer(APawn* Player)
 {
-	if (!DestinationActor)
+	if (DestinationActor.IsNull())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[ArenaPortal] TeleportPlayer called but DestinationActor is not set."));
 		return;
 	}
 
-	Player->SetActorLocation(DestinationActor->GetActorLocation(), false, nullptr, ETeleportType::TeleportPhysics);
-	Player->GetController()->SetControlRotation(DestinationActor->GetActorRotation());
+	// Null until the next arena sublevel is streamed in — the player is already inside the trigger,
+	// so retry next frame instead of waiting for a new overlap
+	AActor* destination{ DestinationActor.Get() };
+	if (!destination)
+	{
+		if (++TeleportRetryFrames > MaxTeleportRetryFrames)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[ArenaPortal] Destination '%s' still not streamed in after %d frames — teleport aborted."),
+				*DestinationActor.ToString(), MaxTeleportRetryFrames);
+			return;
+		}
+
+		UE_LOG(LogTemp, Verbose, TEXT("[ArenaPortal] Destination level not streamed in yet — retrying next frame."));
+
+		TWeakObjectPtr<AArenaPortal> weakThis{ this };
+		TWeakObjectPtr<APawn> weakPlayer{ Player };
+		GetWorldTimerManager().SetTimerForNextTick([weakThis, weakPlayer]()
+			{
+				if (weakThis.IsValid() && weakPlayer.IsValid() && weakThis->OverlapBox->IsOverlappingActor(weakPlayer.Get()))
+					weakThis->TeleportPlayer(weakPlayer.Get());
+			});
+		return;
+	}
+
+	Player->SetActorLocation(destination->GetActorLocation(), false, nullptr, ETeleportType::TeleportPhysics);
+	Player->GetController()->SetControlRotation(destination->GetActorRotation());
 
 	OnPlayerTeleported.Broadcast();
 }
@@ -1,8 +1,38 @@
 #include "DashComponent.h"
+#include "FlowSlayerStats.h"
+#include "Components/CapsuleComponent.h"
+#include "Curves/CurveFloat.h"
+#include "FSCharacterMovementComponent.h"
+
+FFSDashCurveLUT FFSDashCurveLUT::Build(const UCurveFloat* Curve, int32 SampleCount)
+{
+    FFSDashCurveLUT lut;
+    SampleCount = FMath::Max(SampleCount, 2);
+    lut.Samples.SetNumUninitialized(SampleCount);
+
+    for (int32 i{ 0 }; i < SampleCount; ++i)
+    {
+        const float alpha{ static_cast<float>(i) / static_cast<float>(SampleCount - 1) };
+        lut.Samples[i] = Curve ? Curve->GetFloatValue(alpha) : alpha;
+    }
+
+    return lut;
+}
+
+float FFSDashCurveLUT::Evaluate(float alpha) const
+{
+    const int32 lastIndex{ Samples.Num() - 1 };
+    const float position{ FMath::Clamp(alpha, 0.f, 1.f) * lastIndex };
+    const int32 index{ FMath::Min(FMath::FloorToInt32(position), lastIndex - 1) };
+
+    return FMath::Lerp(Samples[index], Samples[index + 1], position - index);
+}
 
 UDashComponent::UDashComponent()
 {
-    PrimaryComponentTick.bCanEverTick = false;
+    // Ticks only while a dash move is running
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UDashComponent::BeginPlay()
@@ -11,14 +41,16 @@ void UDashComponent::BeginPlay()
 
     OwningPlayer = Cast<ACharacter>(GetOwner());
     checkf(OwningPlayer, TEXT("FATAL: Owner is invalid or NULL !"));
+
+    FlowCostStat = UFSStatsComponent::FindAggregate(OwningPlayer, EUpgradeStat::DashFlowCost);
 }
 
 bool UDashComponent::CanDash() const
 {
-    if (CanAffordDash.IsBound() && !CanAffordDash.Execute(FlowCost))
+    if (CanAffordDash.IsBound() && !CanAffordDash.Execute(GetFlowCost()))
         return false;
 
-    return !bIsDashing && !OwningPlayer->GetCharacterMovement()->IsFalling() && !bIsAttacking;
+    return !bIsDashing && !OwningPlayer->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne() && !bIsAttacking;
 }
 
 void UDashComponent::OnAttackingStarted()
@@ -60,6 +92,7 @@ void UDashComponent::StartDash(const FVector2D& inputDirection)
     bIsDashing = true;
 
     // Safety fallback — if NotifyEnd never fires (e.g. montage interrupted before NotifyBegin), force-end the dash
+    FS_INC_COUNTER(TimersCreated);
     GetWorld()->GetTimerManager().SetTimer(
         SafetyTimer,
         [this]() 
@@ -71,33 +104,112 @@ void UDashComponent::StartDash(const FVector2D& inputDirection)
         false
     );
 
-    OnDashStarted.Broadcast(FlowCost);
+    OnDashStarted.Broadcast(GetFlowCost());
 }
 
-void UDashComponent::EndDash()
+void UDashComponent::BeginDashMove(const UCurveFloat* MoveCurve, float Duration)
 {
-    bIsDashing = false;
+    if (!OwningPlayer)
+        return;
 
-    OnDashEnded.Broadcast();
+    verifyf(MoveCurve, TEXT("MoveCurve is NULL or INVALID !"));
+
+    const TObjectKey<UCurveFloat> curveKey{ MoveCurve };
+    if (const TSharedRef<const FFSDashCurveLUT>* lut{ CurveLUTs.Find(curveKey) })
+        MoveLUT = *lut;
+    else
+        MoveLUT = CurveLUTs.Add(curveKey, MakeShared<const FFSDashCurveLUT>(FFSDashCurveLUT::Build(MoveCurve, CurveSampleCount)));
+
+    FRotator cameraYaw{ 0.f, OwningPlayer->GetControlRotation().Yaw, 0.f };
+    FVector forward{ FRotationMatrix(cameraYaw).GetUnitAxis(EAxis::X) };
+    FVector right{ FRotationMatrix(cameraYaw).GetUnitAxis(EAxis::Y) };
+    FVector dashDirection{ (forward * SnappedInput2D.Y + right * SnappedInput2D.X).GetSafeNormal() };
+
+    MoveStart = OwningPlayer->GetActorLocation();
+    MoveDisplacement = dashDirection * Distance;
+    MoveElapsed = 0.f;
+    MoveDuration = FMath::Max(Duration, KINDA_SMALL_NUMBER);
+    LastMoveDeltaTime = 0.f;
+    AppliedCurveValue = MoveLUT->Evaluate(0.f);
+
+    SetComponentTickEnabled(true);
 }
 
-void UDashComponent::HandleOnUpgradeSelected(const FUpgradeData& Upgrade)
+void UDashComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
-    auto ApplyValue = [&Upgrade](float& Stat)
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!MoveLUT)
     {
-        if (Upgrade.ValueType == EUpgradeValueType::Additive)
-            Stat += Upgrade.Value;
-        else
-            Stat *= Upgrade.Value;
-    };
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    MoveElapsed += DeltaTime;
+    LastMoveDeltaTime = DeltaTime;
+    const float alpha{ FMath::Min(MoveElapsed / MoveDuration, 1.f) };
+    AdvanceDashMove(MoveLUT->Evaluate(alpha));
+
+    // Curve fully applied — nothing left to move until NotifyEnd closes the dash
+    if (alpha >= 1.f)
+        StopDashMove();
+}
 
-    switch (Upgrade.Stat)
+void UDashComponent::FinishDashMove()
+{
+    if (!MoveLUT)
+        return;
+
+    // NotifyEnd may run before this frame's tick — one frame short of the duration is still the natural end
+    if (MoveDuration - MoveElapsed <= LastMoveDeltaTime + KINDA_SMALL_NUMBER)
+        AdvanceDashMove(MoveLUT->Evaluate(1.f));
+
+    StopDashMove();
+}
+
+void UDashComponent::AdvanceDashMove(float curveValue)
+{
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_DashMove);
+
+    const FVector deltaMove{ MoveDisplacement * (curveValue - AppliedCurveValue) };
+    AppliedCurveValue = curveValue;
+
+    const float deltaSize{ static_cast<float>(deltaMove.Size()) };
+    if (deltaSize <= KINDA_SMALL_NUMBER)
+        return;
+
+    // Sweeps longer than the capsule radius could step over thin geometry — split them
+    float maxStep{ MaxSubstepDistance };
+    if (const UCapsuleComponent* capsule{ OwningPlayer->GetCapsuleComponent() })
+        maxStep = FMath::Min(maxStep, capsule->GetScaledCapsuleRadius());
+
+    const int32 substeps{ FMath::Clamp(FMath::CeilToInt32(deltaSize / maxStep), 1, MaxSubsteps) };
+    const FVector stepMove{ deltaMove / substeps };
+    const FQuat rotation{ OwningPlayer->GetActorQuat() };
+    UCharacterMovementComponent* movement{ OwningPlayer->GetCharacterMovement() };
+
+    for (int32 step{ 0 }; step < substeps; ++step)
     {
-    case EUpgradeStat::DashFlowCost:
-        ApplyValue(FlowCost);
-        FlowCost = FMath::Max(0.f, FlowCost);
-        break;
-    default:
-        break;
+        FHitResult hitResult;
+        FS_INC_COUNTER(SceneQueries);
+        movement->SafeMoveUpdatedComponent(stepMove, rotation, true, hitResult);
+
+        // Blocked — the rest of this frame's displacement goes into the wall
+        if (hitResult.IsValidBlockingHit())
+            break;
     }
-}
\ No newline at end of file
+}
+
+void UDashComponent::StopDashMove()
+{
+    MoveLUT.Reset();
+    SetComponentTickEnabled(false);
+}
+
+void UDashComponent::EndDash()
+{
+    StopDashMove();
+    bIsDashing = false;
+
+    OnDashEnded.Broadcast();
+}
@@ -0,0 +1,53 @@
+#include "FSActorRegistrySubsystem.h"
+#include "RunManager.h"
+
+bool UFSActorRegistrySubsystem::RegisterRunManager(ARunManager* InRunManager)
+{
+	if (!InRunManager)
+		return false;
+
+	if (RunManager && RunManager != InRunManager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[ActorRegistry] RunManager '%s' already registered — '%s' is a duplicate."),
+			*RunManager->GetName(), *InRunManager->GetName());
+		return false;
+	}
+
+	RunManager = InRunManager;
+	OnRunManagerRegistered.Broadcast(RunManager);
+	return true;
+}
+
+void UFSActorRegistrySubsystem::UnregisterRunManager(ARunManager* InRunManager)
+{
+	if (RunManager == InRunManager)
+		RunManager = nullptr;
+}
+
+void UFSActorRegistrySubsystem::RegisterArena(AFSArenaManager* Arena)
+{
+	if (!Arena || Arenas.Contains(Arena))
+		return;
+
+	Arenas.Add(Arena);
+	OnArenaRegistered.Broadcast(Arena);
+}
+
+void UFSActorRegistrySubsystem::UnregisterArena(AFSArenaManager* Arena)
+{
+	Arenas.Remove(Arena);
+}
+
+void UFSActorRegistrySubsystem::RegisterRewardChest(ARewardChest* Chest)
+{
+	if (!Chest || RewardChests.Contains(Chest))
+		return;
+
+	RewardChests.Add(Chest);
+	OnRewardChestRegistered.Broadcast(Chest);
+}
+
+void UFSActorRegistrySubsystem::UnregisterRewardChest(ARewardChest* Chest)
+{
+	RewardChests.Remove(Chest);
+}
@@ -1,4 +1,6 @@
 #include "FSArenaManager.h"
+#include "FlowSlayerStats.h"
+#include "FSActorRegistrySubsystem.h"
 
 AFSArenaManager::AFSArenaManager()
 {
@@ -7,10 +9,83 @@ AFSArenaManager::AFSArenaManager()
 
 void AFSArenaManager::BeginPlay()
 {
+	if (UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() })
+		registry->RegisterArena(this);
+
+	RequestContentPreload();
+
 	if (bForceActivate)
 		StartArena();
 }
 
+void AFSArenaManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() })
+		registry->UnregisterArena(this);
+
+	GetWorld()->GetTimerManager().ClearTimer(SpawnTimerHandle);
+	ReleaseContentPreload();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AFSArenaManager::RequestContentPreload()
+{
+	TArray<FSoftObjectPath> assets;
+	for (const FSoftObjectPath& asset : PreloadManifest)
+	{
+		if (!asset.IsNull())
+			assets.AddUnique(asset);
+	}
+
+	for (const AAFSSpawnZone* zone : SpawnZones)
+	{
+		if (zone)
+			zone->GatherPreloadAssets(assets);
+	}
+
+	if (ExitPortal)
+		ExitPortal->GatherPreloadAssets(assets);
+
+	if (assets.IsEmpty())
+		return;
+
+	ContentPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		assets,
+		FStreamableDelegate::CreateUObject(this, &AFSArenaManager::HandleOnContentPreloaded)
+	);
+}
+
+void AFSArenaManager::HandleOnContentPreloaded()
+{
+	TArray<FSoftObjectPath> dependencies;
+	for (const AAFSSpawnZone* zone : SpawnZones)
+	{
+		if (zone)
+			zone->GatherEnemyDependencies(dependencies);
+	}
+
+	if (!dependencies.IsEmpty())
+		EnemyDependenciesHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(dependencies);
+
+	UE_LOG(LogTemp, Log, TEXT("[FSArenaManager] Content preloaded (%d enemy dependencies requested)."), dependencies.Num());
+}
+
+void AFSArenaManager::ReleaseContentPreload()
+{
+	if (ContentPreloadHandle.IsValid())
+	{
+		ContentPreloadHandle->ReleaseHandle();
+		ContentPreloadHandle.Reset();
+	}
+
+	if (EnemyDependenciesHandle.IsValid())
+	{
+		EnemyDependenciesHandle->ReleaseHandle();
+		EnemyDependenciesHandle.Reset();
+	}
+}
+
 void AFSArenaManager::StartArena()
 {
 	if (bIsArenaActive)
@@ -25,6 +100,7 @@ void AFSArenaManager::StartArena()
 	TotalKills = 0;
 	AliveEnemyCount = 0;
 	NextEscalationIndex = 0;
+	SpawnDirector.Reset(CurrentMaxAlive);
 
 	UE_LOG(LogTemp, Log, TEXT("[FSArenaManager] Arena started. TotalToSpawn: %d, InitialMaxAlive: %d"),
 		TotalEnemiesToSpawn, InitialMaxAlive);
@@ -43,31 +119,27 @@ void AFSArenaManager::StopArena()
 
 void AFSArenaManager::TrySpawnEnemy()
 {
-	if (!bIsArenaActive || TotalSpawned >= TotalEnemiesToSpawn || AliveEnemyCount >= CurrentMaxAlive)
-	{
-		if (bIsArenaActive && TotalSpawned < TotalEnemiesToSpawn)
-			ScheduleNextSpawn();
-		return;
-	}
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_ArenaTrySpawnEnemy);
 
-	// Pick a random zone
-	int32 randIndex{ FMath::RandRange(0, SpawnZones.Num() - 1) };
-	if (!SpawnZones.IsValidIndex(randIndex) || !SpawnZones[randIndex])
-	{
-		ScheduleNextSpawn();
+	if (!bIsArenaActive || TotalSpawned >= TotalEnemiesToSpawn)
 		return;
-	}
 
-	AFSEnemy* spawnedEnemy{ SpawnZones[randIndex]->SpawnEnemy() };
+	GatherSpawnCandidates(SpawnCandidates);
+
+	const FFSSpawnCandidate* candidate{ SpawnDirector.PickCandidate(SpawnCandidates) };
+	AFSEnemy* spawnedEnemy{ candidate ? candidate->Zone->SpawnEnemy(candidate->EnemyClass) : nullptr };
 	if (spawnedEnemy)
 	{
 		TotalSpawned++;
 		AliveEnemyCount++;
+		SpawnDirector.NotifySpawned(*spawnedEnemy->GetArchetype());
 		spawnedEnemy->OnEnemyDeath.AddUniqueDynamic(this, &AFSArenaManager::HandleOnEnemyDeath);
+		FS_INC_COUNTER(DelegateBroadcasts);
 		OnEnemySpawned.Broadcast(spawnedEnemy);
 
-		UE_LOG(LogTemp, Log, TEXT("[FSArenaManager] Enemy spawned. Alive: %d/%d, Spawned: %d/%d"),
-			AliveEnemyCount, CurrentMaxAlive, TotalSpawned, TotalEnemiesToSpawn);
+		const FFSSpawnBudgetState& budget{ SpawnDirector.GetState() };
+		UE_LOG(LogTemp, Log, TEXT("[FSArenaManager] Enemy spawned. Difficulty: %d/%d, FrameCost: %.2f/%.2f ms, Spawned: %d/%d"),
+			budget.Difficulty, budget.DifficultyTarget, budget.FrameCostMs, budget.FrameBudgetMs, TotalSpawned, TotalEnemiesToSpawn);
 	}
 
 	// Keep spawning if budget remains
@@ -75,10 +147,21 @@ void AFSArenaManager::TrySpawnEnemy()
 		ScheduleNextSpawn();
 }
 
+void AFSArenaManager::GatherSpawnCandidates(TArray<FFSSpawnCandidate>& OutCandidates)
+{
+	OutCandidates.Reset();
+	for (AAFSSpawnZone* zone : SpawnZones)
+	{
+		if (zone)
+			zone->GatherSpawnCandidates(OutCandidates);
+	}
+}
+
 void AFSArenaManager::ScheduleNextSpawn()
 {
-	float cooldown{ FMath::RandRange(MinSpawnCooldown, MaxSpawnCooldown) };
+	float cooldown{ SpawnDirector.GetNextSpawnDelay(MinSpawnCooldown, MaxSpawnCooldown) };
 	GetWorld()->GetTimerManager().ClearTimer(SpawnTimerHandle);
+	FS_INC_COUNTER(TimersCreated);
 	GetWorld()->GetTimerManager().SetTimer(
 		SpawnTimerHandle,
 		this,
@@ -90,6 +173,12 @@ void AFSArenaManager::ScheduleNextSpawn()
 
 void AFSArenaManager::HandleOnEnemyDeath(AFSEnemy* Enemy)
 {
+	if (Enemy)
+	{
+		Enemy->OnEnemyDeath.RemoveDynamic(this, &AFSArenaManager::HandleOnEnemyDeath);
+		SpawnDirector.NotifyDespawned(*Enemy->GetArchetype());
+	}
+
 	AliveEnemyCount--;
 	TotalKills++;
 
@@ -114,9 +203,10 @@ void AFSArenaManager::CheckCapEscalation()
 		if (TotalKills >= step.KillThreshold)
 		{
 			CurrentMaxAlive = FMath::Min(CurrentMaxAlive + step.MaxAliveIncrease, MaxAliveLimit);
+			SpawnDirector.SetDifficultyTarget(CurrentMaxAlive);
 			NextEscalationIndex++;
 
-			UE_LOG(LogTemp, Log, TEXT("[FSArenaManager] MaxAlive escalated to %d at %d kills"),
+			UE_LOG(LogTemp, Log, TEXT("[FSArenaManager] Difficulty target escalated to %d at %d kills"),
 				CurrentMaxAlive, TotalKills);
 		}
 		else
@@ -0,0 +1,75 @@
+#include "FSAsyncOverlapProbe.h"
+#include "FlowSlayerStats.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+
+void FFSAsyncOverlapProbe::Poll(UWorld* World)
+{
+	if (!World || !PendingHandle.IsValid())
+		return;
+
+	// Async results are only readable the frame after the request
+	if (PendingFrame >= GFrameCounter)
+		return;
+
+	FOverlapDatum overlapDatum;
+	const bool bReady{ World->QueryOverlapData(PendingHandle, overlapDatum) };
+	PendingHandle = FTraceHandle();
+
+	if (!bReady)
+		return;
+
+	Results.Reset();
+	for (const FOverlapResult& overlap : overlapDatum.OutOverlaps)
+	{
+		if (AActor* actor{ overlap.GetActor() })
+			Results.AddUnique(actor);
+	}
+
+	ResultsFrame = PendingFrame;
+	ResultsRadius = PendingRadius;
+}
+
+void FFSAsyncOverlapProbe::Request(UWorld* World, const FVector& Center, float Radius, ECollisionChannel ObjectChannel, const AActor* IgnoredActor)
+{
+	if (!World)
+		return;
+
+	FCollisionQueryParams queryParams{ SCENE_QUERY_STAT(FSAsyncOverlapProbe), false, IgnoredActor };
+
+	FS_INC_COUNTER(AsyncSceneQueries);
+	PendingHandle = World->AsyncOverlapByObjectType(Center, FQuat::Identity, FCollisionObjectQueryParams(ObjectChannel),
+		FCollisionShape::MakeSphere(Radius), queryParams);
+	PendingFrame = GFrameCounter;
+	PendingRadius = Radius;
+}
+
+bool FFSAsyncOverlapProbe::GetActorsInRadius(UWorld* World, const FVector& Center, float Radius, TArray<AActor*>& OutActors)
+{
+	Poll(World);
+
+	if (ResultsFrame == 0 || GFrameCounter - ResultsFrame > 1 || Radius > ResultsRadius)
+		return false;
+
+	// The probe was centered where the owner stood last frame — re-filter around the current center
+	for (const TWeakObjectPtr<AActor>& result : Results)
+	{
+		AActor* actor{ result.Get() };
+		if (!actor)
+			continue;
+
+		const float reach{ Radius + actor->GetSimpleCollisionRadius() };
+		if (FVector::DistSquared(Center, actor->GetActorLocation()) <= FMath::Square(reach))
+			OutActors.Add(actor);
+	}
+
+	return true;
+}
+
+void FFSAsyncOverlapProbe::Reset()
+{
+	PendingHandle = FTraceHandle();
+	PendingFrame = 0;
+	Results.Reset();
+	ResultsFrame = 0;
+}
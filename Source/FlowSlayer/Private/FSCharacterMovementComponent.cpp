@@ -0,0 +1,127 @@
+#include "FSCharacterMovementComponent.h"
+#include "FlowSlayerStats.h"
+#include "GameFramework/Character.h"
+#include "Curves/CurveFloat.h"
+
+void UFSCharacterMovementComponent::StartAirJuggle(float HangTime)
+{
+	const float hangScale{ FMath::Max(FMath::Pow(1.f - AirJuggleDecay, static_cast<float>(JuggleCount)), AirJuggleMinHangScale) };
+	JuggleHangTime = HangTime * hangScale;
+	JuggleElapsed = 0.f;
+	++JuggleCount;
+
+	EnterAirJuggle();
+}
+
+void UFSCharacterMovementComponent::HoldAirJuggle()
+{
+	if (!IsAirJuggling())
+	{
+		JuggleHangTime = 0.f;
+		JuggleElapsed = 0.f;
+	}
+
+	++AirJuggleHolds;
+	EnterAirJuggle();
+}
+
+void UFSCharacterMovementComponent::ReleaseAirJuggle()
+{
+	AirJuggleHolds = FMath::Max(AirJuggleHolds - 1, 0);
+}
+
+void UFSCharacterMovementComponent::EnterAirJuggle()
+{
+	Velocity.Z = 0.f;
+
+	if (!IsAirJuggling())
+		SetMovementMode(MOVE_Custom, static_cast<uint8>(EFSCustomMovementMode::AirJuggle));
+}
+
+bool UFSCharacterMovementComponent::HandlePendingLaunch()
+{
+	if (!IsAirJuggling() || PendingLaunchVelocity.IsZero() || !HasValidData())
+		return Super::HandlePendingLaunch();
+
+	Velocity = PendingLaunchVelocity;
+	PendingLaunchVelocity = FVector::ZeroVector;
+	bForceNextFloorCheck = true;
+	return true;
+}
+
+void UFSCharacterMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+	const bool bWasJuggling{ PreviousMovementMode == MOVE_Custom && PreviousCustomMode == static_cast<uint8>(EFSCustomMovementMode::AirJuggle) };
+	if (bWasJuggling && !IsAirJuggling())
+		AirJuggleHolds = 0;
+
+	if (IsMovingOnGround())
+		JuggleCount = 0;
+}
+
+void UFSCharacterMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	if (CustomMovementMode == static_cast<uint8>(EFSCustomMovementMode::AirJuggle))
+	{
+		PhysAirJuggle(deltaTime, Iterations);
+		return;
+	}
+
+	Super::PhysCustom(deltaTime, Iterations);
+}
+
+void UFSCharacterMovementComponent::PhysAirJuggle(float deltaTime, int32 Iterations)
+{
+	if (deltaTime < MIN_TICK_TIME)
+		return;
+
+	JuggleElapsed += deltaTime;
+
+	// Hang over — the only mode switch of a juggle, however many re-stalls it had
+	if (AirJuggleHolds == 0 && JuggleElapsed >= JuggleHangTime)
+	{
+		SetMovementMode(MOVE_Falling);
+		StartNewPhysics(deltaTime, Iterations);
+		return;
+	}
+
+	// Root motion (launcher warp, air attacks) drives the velocity by itself
+	const bool bRootMotion{ HasAnimRootMotion() || CurrentRootMotion.HasOverrideVelocity() };
+	if (!bRootMotion)
+	{
+		const float hangAlpha{ AirJuggleHolds > 0 || JuggleHangTime <= 0.f ? 0.f : JuggleElapsed / JuggleHangTime };
+		const float gravityScale{ AirJuggleGravityCurve ? AirJuggleGravityCurve->GetFloatValue(hangAlpha) : 0.f };
+
+		Velocity *= FMath::Exp(-AirJuggleDamping * deltaTime);
+		Velocity.Z += GetGravityZ() * gravityScale * deltaTime;
+	}
+
+	Iterations++;
+	bJustTeleported = false;
+
+	const FVector oldLocation{ UpdatedComponent->GetComponentLocation() };
+	const FVector delta{ Velocity * deltaTime };
+	FHitResult hit(1.f);
+	SafeMoveUpdatedComponent(delta, UpdatedComponent->GetComponentQuat(), true, hit);
+
+	if (hit.Time < 1.f)
+	{
+		if (Velocity.Z <= 0.f && IsValidLandingSpot(UpdatedComponent->GetComponentLocation(), hit))
+		{
+			if (CharacterOwner && CharacterOwner->ShouldNotifyLanded(hit))
+				CharacterOwner->Landed(hit);
+
+			SetPostLandedPhysics(hit);
+			StartNewPhysics(deltaTime * (1.f - hit.Time), Iterations);
+			return;
+		}
+
+		HandleImpact(hit, deltaTime, delta);
+		SlideAlongSurface(delta, 1.f - hit.Time, hit.Normal, hit, true);
+	}
+
+	if (!bJustTeleported && !bRootMotion)
+		Velocity = (UpdatedComponent->GetComponentLocation() - oldLocation) / deltaTime;
+}
@@ -1,4 +1,7 @@
 #include "FSCombatComponent.h"
+#include "FlowSlayerStats.h"
+#include "FSHitboxTimelineSubsystem.h"
+#include "FSCharacterMovementComponent.h"
 
 UFSCombatComponent::UFSCombatComponent()
 {
@@ -34,21 +37,79 @@ void UFSCombatComponent::BeginPlay()
 
     checkf(PlayerOwner && AnimInstance && equippedWeapon && HitboxComponent, TEXT("FATAL: One or more Core CombatComponent variables are NULL"));
 
+    DamageStat = UFSStatsComponent::FindAggregate(PlayerOwner, EUpgradeStat::Damage);
+    AttackCooldownStat = UFSStatsComponent::FindAggregate(PlayerOwner, EUpgradeStat::AttackCooldown);
+    AttackPlayRateStat = UFSStatsComponent::FindAggregate(PlayerOwner, EUpgradeStat::AttackPlayRate);
+
     HitboxComponent->OnHitboxHitLanded.BindUObject(this, &UFSCombatComponent::HandleOnHitLanded);
     HitboxComponent->SetOwnerWeaponRef(equippedWeapon);
 
     OnComboInputWindowOpened.BindUObject(this, &UFSCombatComponent::HandleComboInputWindowOpened);
     OnComboInputWindowClosed.BindUObject(this, &UFSCombatComponent::HandleComboInputWindowClosed);
 
-    // Initialize combo attack data (damage, knockback, ChainableAttacks)
-    InitializeComboAttackData();
+    {
+        LLM_SCOPE_BYTAG(FlowSlayer_CombatData);
+
+        // Initialize combo attack data (damage, knockback, ChainableAttacks)
+        InitializeComboAttackData();
+
+        // Initialize combo lookup table for fast attack selection
+        InitializeComboLookupTable();
+    }
 
-    // Initialize combo lookup table for fast attack selection
-    InitializeComboLookupTable();
+    // Stream in the whole moveset + hit VFX before the first attack input
+    RequestCombatContentPreload();
 
     PlayerOwner->LandedDelegate.AddDynamic(this, &UFSCombatComponent::HandleOnLanded);
 }
 
+void UFSCombatComponent::RequestCombatContentPreload()
+{
+    TArray<FSoftObjectPath> assets;
+    for (const TPair<EAttackType, FCombo*>& entry : ComboLookupTable)
+    {
+        for (const FAttackData& attack : entry.Value->Attacks)
+        {
+            if (!attack.Montage.IsNull())
+                assets.AddUnique(attack.Montage.ToSoftObjectPath());
+        }
+    }
+
+    HitFeedBackComponent->GatherPreloadAssets(assets);
+
+    if (!assets.IsEmpty())
+        CombatContentHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(assets,
+            FStreamableDelegate::CreateUObject(this, &UFSCombatComponent::HandleCombatContentLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UFSCombatComponent::HandleCombatContentLoaded()
+{
+    UFSHitboxTimelineSubsystem* timelineSubsystem{ GetWorld()->GetSubsystem<UFSHitboxTimelineSubsystem>() };
+    if (!timelineSubsystem)
+        return;
+
+    // Compiled now rather than on the first swing of each attack
+    for (const TPair<EAttackType, FCombo*>& entry : ComboLookupTable)
+    {
+        for (const FAttackData& attack : entry.Value->Attacks)
+        {
+            if (const UAnimMontage* montage{ attack.Montage.Get() })
+                timelineSubsystem->GetTimeline(montage);
+        }
+    }
+}
+
+void UFSCombatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (CombatContentHandle.IsValid())
+    {
+        CombatContentHandle->ReleaseHandle();
+        CombatContentHandle.Reset();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 bool UFSCombatComponent::InitializeAndAttachWeapon()
 {
     if (!weaponClass)
@@ -153,7 +214,7 @@ void UFSCombatComponent::InitializeComboAttackData()
     JumpSlamAttack.Attacks[0] = *GetAttackData("JumpSlam");
     JumpSlamAttack.Attacks[0].OnAttackExecuted.BindLambda([this]()
         {
-            if (PlayerOwner->GetCharacterMovement()->IsFalling() || PlayerOwner->GetCharacterMovement()->IsFlying())
+            if (PlayerOwner->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
                 AnimInstance->Montage_JumpToSection(FName("AirStart"), AnimInstance->GetCurrentActiveMontage());
             else
                 AnimInstance->Montage_JumpToSection(FName("ComboStart"), AnimInstance->GetCurrentActiveMontage());
@@ -164,7 +225,7 @@ void UFSCombatComponent::InitializeComboAttackData()
     JumpForwardSlamAttack.Attacks[0] = *GetAttackData("JumpForwardSlam");
     JumpForwardSlamAttack.Attacks[0].OnAttackExecuted.BindLambda([this]()
         {
-            if (PlayerOwner->GetCharacterMovement()->IsFalling() || PlayerOwner->GetCharacterMovement()->IsFlying())
+            if (PlayerOwner->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
                 AnimInstance->Montage_JumpToSection(FName("AirStart"), AnimInstance->GetCurrentActiveMontage());
             else
                 AnimInstance->Montage_JumpToSection(FName("ComboStart"), AnimInstance->GetCurrentActiveMontage());
@@ -175,7 +236,7 @@ void UFSCombatComponent::InitializeComboAttackData()
     JumpUpperSlamComboAttack.Attacks[0] = *GetAttackData("JumpUpperSlam");
     JumpUpperSlamComboAttack.Attacks[0].OnAttackExecuted.BindLambda([this]()
         {
-            if (PlayerOwner->GetCharacterMovement()->IsFalling() || PlayerOwner->GetCharacterMovement()->IsFlying())
+            if (PlayerOwner->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
                 AnimInstance->Montage_JumpToSection(FName("AirStart"), AnimInstance->GetCurrentActiveMontage());
             else
                 AnimInstance->Montage_JumpToSection(FName("ComboStart"), AnimInstance->GetCurrentActiveMontage());
@@ -253,7 +314,7 @@ void UFSCombatComponent::OnAttackInputReceived(EAttackType attackType)
     if (!ongoingAttack || ongoingAttack->bOnCooldown)
         return;
 
-    UAnimMontage* animAttack{ ongoingAttack->Montage };
+    UAnimMontage* animAttack{ ongoingAttack->ResolveMontage() };
     if (!animAttack)
         return;
 
@@ -275,8 +336,7 @@ FCombo* UFSCombatComponent::GetComboFromContext(EAttackType attackType)
     if (!foundCombo || !(*foundCombo)->IsValid())
         return nullptr;
 
-    bool bIsFalling{ PlayerOwner->GetCharacterMovement()->IsFalling() };
-    bool bIsFlying{ PlayerOwner->GetCharacterMovement()->IsFlying() };
+    bool bIsAirborne{ PlayerOwner->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne() };
     bool bIsAirAttack{ (*foundCombo)->GetFirstAttack() && (*foundCombo)->GetFirstAttack()->AttackContext == EAttackDataContext::Air };
 
     // First attack of that combo that can be performed in air and ground
@@ -285,11 +345,11 @@ FCombo* UFSCombatComponent::GetComboFromContext(EAttackType attackType)
         return *foundCombo;
 
     // Reject air-only attacks on ground
-    else if (bIsAirAttack && !bIsFalling && !bIsFlying)
+    else if (bIsAirAttack && !bIsAirborne)
         return nullptr;
 
     // Reject ground-only attacks in air
-    else if (!bIsAirAttack && (bIsFalling || bIsFlying))
+    else if (!bIsAirAttack && bIsAirborne)
         return nullptr;
 
     return *foundCombo;
@@ -297,18 +357,21 @@ FCombo* UFSCombatComponent::GetComboFromContext(EAttackType attackType)
 
 void UFSCombatComponent::ExecuteAttack(UAnimMontage* attackMontage)
 {
-    PlayerOwner->PlayAnimMontage(attackMontage, AttackPlayRateMultiplier);
+    PlayerOwner->PlayAnimMontage(attackMontage, FMath::Max(0.1f, AttackPlayRateStat->Apply(1.f)));
 
     FAttackData* ongoingAttack{ &OngoingCombo->Attacks[ComboIndex] };
     ongoingAttack->OnAttackExecuted.ExecuteIfBound();
-    ongoingAttack->StartCooldown(GetWorld(), AttackCooldownMultiplier);
+
+    // After OnAttackExecuted — the jump slams jump to their start section there, the timeline starts from it
+    HitboxComponent->StartTimeline(attackMontage);
+    ongoingAttack->StartCooldown(GetWorld(), FMath::Max(0.1f, AttackCooldownStat->Apply(1.f)));
 }
 
 void UFSCombatComponent::CancelAttack(float blendOutTime)
 {
     AnimInstance->StopAllMontages(blendOutTime);
     ResetComboState();
-    HitboxComponent->OnActiveFrameStopped.ExecuteIfBound();
+    HitboxComponent->StopTimeline();
 }
 
 FAttackData* UFSCombatComponent::GetAttackData(FName rowName) const
@@ -357,7 +420,7 @@ void UFSCombatComponent::ChainingToNextCombo()
     if (!ongoingAttack)
         return;
 
-    UAnimMontage* attackMontage{ ongoingAttack->Montage };
+    UAnimMontage* attackMontage{ ongoingAttack->ResolveMontage() };
     if (!attackMontage)
         return;
 
@@ -385,7 +448,7 @@ void UFSCombatComponent::ContinueCombo()
     if (!ongoingAttack)
         return;
 
-    UAnimMontage* attackMontage{ ongoingAttack->Montage };
+    UAnimMontage* attackMontage{ ongoingAttack->ResolveMontage() };
     if (!attackMontage)
         return;
 
@@ -426,7 +489,7 @@ void UFSCombatComponent::ResetComboState()
 {
     // If the player is not falling or flying during a reset, that means he was ground attacking
     // so there's no need to prevent player from air attacking
-    if (PlayerOwner->GetCharacterMovement()->IsFalling() || PlayerOwner->GetCharacterMovement()->IsFlying())
+    if (PlayerOwner->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
         bCanAirAttack = false;
 
     ComboIndex = 0;
@@ -447,6 +510,8 @@ void UFSCombatComponent::ResetComboState()
 ////////////////////////////////////////////////
 void UFSCombatComponent::HandleOnHitLanded(AActor* hitActor, const FVector& hitLocation)
 {
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_CombatHandleOnHitLanded);
+
     IFSDamageable* hitActorDamageable{ Cast<IFSDamageable>(hitActor) };
     if (!hitActor || !hitActorDamageable || (hitActorDamageable && hitActorDamageable->GetHealthComponent()->IsDead()))
         return;
@@ -472,14 +537,11 @@ void UFSCombatComponent::HandleOnHitLanded(AActor* hitActor, const FVector& hitL
     OngoingAttackComboWindowDuration = currentAttack->ComboWindowDuration;
     ComboTimeRemaining = OngoingAttackComboWindowDuration;
 
-    // Apply damage multiplier from upgrades — copy so DataTable row stays unmodified
+    // Apply damage stat from upgrades and weapon parts — copy so DataTable row stays unmodified
     FAttackData scaledAttack{ *currentAttack };
-    scaledAttack.Damage *= DamageMultiplier;
-
-    // Apply weapon part damage multiplier (1.0 if no Blade part equipped)
-    if (equippedWeapon)
-        scaledAttack.Damage *= equippedWeapon->GetDamageMultiplier();
+    scaledAttack.Damage *= FMath::Max(0.f, DamageStat->Apply(1.f));
 
+    FS_INC_COUNTER(DelegateBroadcasts);
     OnHitLanded.Broadcast(hitActor, hitLocation, scaledAttack);
 
     HitFeedBackComponent->OnLandHit(hitActor->GetActorLocation());
@@ -487,34 +549,6 @@ void UFSCombatComponent::HandleOnHitLanded(AActor* hitActor, const FVector& hitL
     hitActorDamageable->NotifyHitReceived(PlayerOwner, scaledAttack);
 }
 
-void UFSCombatComponent::HandleOnUpgradeSelected(const FUpgradeData& Upgrade)
-{
-    auto ApplyMultiplicative = [&Upgrade](float& Multiplier)
-    {
-        // Combat upgrades only support multiplicative — guard against misconfig
-        if (Upgrade.ValueType == EUpgradeValueType::Additive)
-            Multiplier += Upgrade.Value;
-        else
-            Multiplier *= Upgrade.Value;
-    };
-
-    switch (Upgrade.Stat)
-    {
-    case EUpgradeStat::Damage:
-        ApplyMultiplicative(DamageMultiplier);
-        DamageMultiplier = FMath::Max(0.f, DamageMultiplier);
-        break;
-    case EUpgradeStat::AttackCooldown:
-        ApplyMultiplicative(AttackCooldownMultiplier);
-        AttackCooldownMultiplier = FMath::Max(0.1f, AttackCooldownMultiplier);
-        break;
-    case EUpgradeStat::AttackPlayRate:
-        ApplyMultiplicative(AttackPlayRateMultiplier);
-        AttackPlayRateMultiplier = FMath::Max(0.1f, AttackPlayRateMultiplier);
-        break;
-    }
-}
-
 void UFSCombatComponent::ResetComboCounter()
 {
     ComboHitCount = 0;
@@ -533,7 +567,7 @@ float UFSCombatComponent::GetComboTimeRatio() const
 
 void UFSCombatComponent::ToggleGuard()
 {
-    bool bInAir{ PlayerOwner->GetCharacterMovement()->IsFalling() || PlayerOwner->GetCharacterMovement()->IsFlying() };
+    bool bInAir{ PlayerOwner->GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne() };
 
     if (bIsAttacking || bInAir)
     {
@@ -0,0 +1,226 @@
+#include "FSCrowdSubsystem.h"
+#include "FlowSlayerStats.h"
+#include "FSEnemy.h"
+#include "FSEnemyAIController.h"
+#include "Async/ParallelFor.h"
+#include "Kismet/GameplayStatics.h"
+
+static TAutoConsoleVariable<bool> CVarCrowdSeparation(
+	TEXT("fs.Crowd.Separation"),
+	true,
+	TEXT("Whether enemies steer away from each other (crowd separation pass)."));
+
+static TAutoConsoleVariable<bool> CVarMovementLOD(
+	TEXT("fs.Crowd.MovementLOD"),
+	true,
+	TEXT("Whether distant enemies switch to the reduced mover (NavWalking at a lower tick rate)."));
+
+static TAutoConsoleVariable<float> CVarLODDistance(
+	TEXT("fs.Crowd.LODDistance"),
+	4000.f,
+	TEXT("Distance to the player (cm) beyond which enemies use the reduced mover — 0 reduces every enemy not attacking or recently hit."));
+
+void UFSCrowdSubsystem::RegisterEnemy(AFSEnemy* Enemy)
+{
+	if (Enemy)
+		Enemies.AddUnique(Enemy);
+}
+
+void UFSCrowdSubsystem::UnregisterEnemy(AFSEnemy* Enemy)
+{
+	Enemies.RemoveSingleSwap(Enemy);
+}
+
+void UFSCrowdSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Enemies.IsEmpty())
+		return;
+
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_EnemyUpdate);
+
+	const APawn* player{ UGameplayStatics::GetPlayerPawn(GetWorld(), 0) };
+	bHasPlayer = player != nullptr;
+	PlayerLocation = player ? player->GetActorLocation() : FVector::ZeroVector;
+	bSeparationEnabled = Enemies.Num() > 1 && CVarCrowdSeparation.GetValueOnGameThread();
+	bMovementLODEnabled = bHasPlayer && CVarMovementLOD.GetValueOnGameThread();
+	LODDemoteDistSquared = FMath::Square(CVarLODDistance.GetValueOnGameThread());
+	LODPromoteDistSquared = LODDemoteDistSquared * FMath::Square(lodPromoteRatio);
+	Now = GetWorld()->GetTimeSeconds();
+	DeltaSeconds = DeltaTime;
+
+	GatherAgents();
+	if (bSeparationEnabled)
+		BuildGrid();
+
+	ComputeAgents();
+	ApplyAgents();
+}
+
+TStatId UFSCrowdSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFSCrowdSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== READ STAGE ====================
+
+void UFSCrowdSubsystem::GatherAgents()
+{
+	Agents.SetNum(Enemies.Num());
+	Controllers.SetNumUninitialized(Enemies.Num());
+
+	float maxRadius{ 0.f };
+	for (int32 i{ 0 }; i < Enemies.Num(); ++i)
+	{
+		const AFSEnemy* enemy{ Enemies[i] };
+		const UFSEnemyArchetype* archetype{ enemy->GetArchetype() };
+		const UCharacterMovementComponent* movement{ enemy->GetCharacterMovement() };
+		AFSEnemyAIController* controller{ Cast<AFSEnemyAIController>(enemy->GetController()) };
+		Controllers[i] = controller;
+
+		FFSCrowdAgent& agent{ Agents[i] };
+		agent = FFSCrowdAgent{};
+		agent.Location = enemy->GetActorLocation();
+		agent.Location2D = FVector2f(static_cast<float>(agent.Location.X), static_cast<float>(agent.Location.Y));
+		agent.Radius = archetype->CrowdRadius;
+		agent.Strength = archetype->CrowdSeparationStrength;
+		agent.LastHitReceivedTime = enemy->GetLastHitReceivedTime();
+		agent.bOnGround = movement->IsMovingOnGround();
+		agent.bAttacking = enemy->IsAttacking();
+		agent.bCanAttack = enemy->CanAttack();
+		agent.bMoveIdle = controller && controller->GetMoveStatus() == EPathFollowingStatus::Idle;
+		agent.bMovementReduced = enemy->IsMovementReduced();
+
+		maxRadius = FMath::Max(maxRadius, agent.Radius);
+	}
+
+	CellSize = FMath::Max(2.f * maxRadius, 1.f);
+}
+
+void UFSCrowdSubsystem::BuildGrid()
+{
+	// Counting sort by cell: count, prefix-sum into start offsets, then scatter
+	Cells.Reset();
+	AgentCells.SetNumUninitialized(Agents.Num());
+	for (int32 i{ 0 }; i < Agents.Num(); ++i)
+	{
+		AgentCells[i] = GetCell(Agents[i].Location2D);
+		Cells.FindOrAdd(AgentCells[i]).Count++;
+	}
+
+	int32 start{ 0 };
+	for (TPair<FIntPoint, FFSCrowdCell>& cell : Cells)
+	{
+		cell.Value.Start = start;
+		start += cell.Value.Count;
+		cell.Value.Count = 0;
+	}
+
+	SortedAgents.SetNumUninitialized(Agents.Num());
+	for (int32 i{ 0 }; i < Agents.Num(); ++i)
+	{
+		FFSCrowdCell& cell{ Cells[AgentCells[i]] };
+		SortedAgents[cell.Start + cell.Count++] = i;
+	}
+}
+
+// ==================== COMPUTE STAGE ====================
+
+void UFSCrowdSubsystem::ComputeAgents()
+{
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_EnemyUpdateCompute);
+
+	ParallelFor(TEXT("FS.EnemyUpdate"), Agents.Num(), minBatchSize, [this](int32 agentIndex)
+	{
+		ComputeAgent(agentIndex);
+	});
+}
+
+void UFSCrowdSubsystem::ComputeAgent(int32 AgentIndex)
+{
+	FFSCrowdAgent& agent{ Agents[AgentIndex] };
+
+	agent.bFollowPlayer = bHasPlayer && agent.bMoveIdle && !agent.bAttacking && agent.bCanAttack;
+
+	if (bMovementLODEnabled && !agent.bAttacking)
+	{
+		const bool bRecentlyHit{ agent.LastHitReceivedTime >= 0.0 && Now - agent.LastHitReceivedTime < lodHitHoldDuration };
+		const double distSquared{ FVector::DistSquared2D(agent.Location, PlayerLocation) };
+		agent.bWantsReducedMovement = !bRecentlyHit && distSquared >= (agent.bMovementReduced ? LODPromoteDistSquared : LODDemoteDistSquared);
+	}
+
+	// Airborne (air juggle) and attacking enemies are obstacles only
+	if (bSeparationEnabled && agent.bOnGround && !agent.bAttacking)
+		agent.Separation = ComputeAgentSeparation(AgentIndex);
+}
+
+FVector2f UFSCrowdSubsystem::ComputeAgentSeparation(int32 AgentIndex) const
+{
+	const FFSCrowdAgent& agent{ Agents[AgentIndex] };
+	const FIntPoint center{ AgentCells[AgentIndex] };
+
+	FVector2f push{ FVector2f::ZeroVector };
+	for (int32 y{ center.Y - 1 }; y <= center.Y + 1; ++y)
+	{
+		for (int32 x{ center.X - 1 }; x <= center.X + 1; ++x)
+		{
+			const FFSCrowdCell* cell{ Cells.Find(FIntPoint(x, y)) };
+			if (!cell)
+				continue;
+
+			for (int32 i{ cell->Start }; i < cell->Start + cell->Count; ++i)
+			{
+				const int32 otherIndex{ SortedAgents[i] };
+				if (otherIndex == AgentIndex)
+					continue;
+
+				const FFSCrowdAgent& other{ Agents[otherIndex] };
+				const float personalSpace{ agent.Radius + other.Radius };
+				const FVector2f delta{ agent.Location2D - other.Location2D };
+				const float distSquared{ delta.SizeSquared() };
+				if (distSquared >= FMath::Square(personalSpace))
+					continue;
+
+				// Stacked agents split along an axis ordered by index so both sides move apart
+				const float dist{ FMath::Sqrt(distSquared) };
+				const FVector2f direction{ dist > coincidentDistance ? delta / dist : FVector2f(AgentIndex < otherIndex ? 1.f : -1.f, 0.f) };
+				push += direction * (1.f - dist / personalSpace);
+			}
+		}
+	}
+
+	return (push * agent.Strength).GetClampedToMaxSize(1.f);
+}
+
+// ==================== APPLY STAGE ====================
+
+void UFSCrowdSubsystem::ApplyAgents()
+{
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_EnemyUpdateApply);
+
+	ReducedMovementCount = 0;
+	for (int32 i{ 0 }; i < Enemies.Num(); ++i)
+	{
+		AFSEnemy* enemy{ Enemies[i] };
+		const FFSCrowdAgent& agent{ Agents[i] };
+
+		enemy->SetReducedMovement(agent.bWantsReducedMovement);
+		enemy->UpdateMovementSmoothing(DeltaSeconds);
+		ReducedMovementCount += enemy->IsMovementReduced() ? 1 : 0;
+
+		// Added to the path following acceleration on the next movement tick, within the CMC speed limits
+		if (!agent.Separation.IsNearlyZero())
+			enemy->GetCharacterMovement()->AddInputVector(FVector(agent.Separation.X, agent.Separation.Y, 0.f));
+
+		if (agent.bFollowPlayer && Controllers[i])
+			Controllers[i]->FollowPlayer();
+	}
+
+	SET_DWORD_STAT(STAT_FS_ReducedMovementEnemies, ReducedMovementCount);
+}
+
+FIntPoint UFSCrowdSubsystem::GetCell(const FVector2f& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
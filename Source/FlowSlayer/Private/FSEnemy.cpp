@@ -1,18 +1,22 @@
 #include "../Public/FSEnemy.h"
+#include "FlowSlayerStats.h"
+#include "FSWorldMarkerSubsystem.h"
+#include "FSCrowdSubsystem.h"
 
-AFSEnemy::AFSEnemy()
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+AFSEnemy::AFSEnemy(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UFSCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
     PrimaryActorTick.bCanEverTick = false;
 
     GetCharacterMovement()->bOrientRotationToMovement = true;
-    AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
 
-    // Lock On UI setup
-    LockOnWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("LockOnWidget"));
-    LockOnWidget->SetupAttachment(GetMesh());
-    LockOnWidget->SetWidgetSpace(EWidgetSpace::Screen);
-    LockOnWidget->SetDrawSize(FVector2D(40.0f, 40.0f));
-    LockOnWidget->SetVisibility(false);
+    // NavWalking (distant mover) snaps to the real floor with a periodic trace instead of the raw navmesh height
+    GetCharacterMovement()->bProjectNavMeshWalking = true;
+    AutoPossessAI = EAutoPossessAI::PlacedInWorldOrSpawned;
 
     HitboxComponent = CreateDefaultSubobject<UHitboxComponent>(TEXT("HitboxComponent"));
     checkf(HitboxComponent, TEXT("FATAL: HitboxComponent is NULL or INVALID !"));
@@ -35,26 +39,81 @@ void AFSEnemy::BeginPlay()
 
     Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
 
+    NotifyContext.Initialize(this);
+
     UAnimInstance* AnimInstance{ GetMesh()->GetAnimInstance() };
     if (AnimInstance)
         AnimInstance->OnMontageEnded.AddDynamic(this, &AFSEnemy::HandleOnMontageEnded);
 
+    checkf(Archetype, TEXT("FATAL: [Enemy] %s has no Archetype — assign a UFSEnemyArchetype data asset in its class defaults."), *GetClass()->GetName());
+
     // Ignoring Player's camera collision to avoid weird camera snap
     GetCapsuleComponent()->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
     GetMesh()->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+
+    LastSmoothedLocation = GetActorLocation();
+    LastSmoothedYaw = GetActorRotation().Yaw;
+
+    if (UFSCrowdSubsystem* crowd{ GetWorld()->GetSubsystem<UFSCrowdSubsystem>() })
+        crowd->RegisterEnemy(this);
+}
+
+#if WITH_EDITOR
+EDataValidationResult AFSEnemy::IsDataValid(FDataValidationContext& Context) const
+{
+    EDataValidationResult result{ Super::IsDataValid(Context) };
+
+    // Abstract bases are never spawned — their concrete Blueprints carry the archetype
+    if (!Archetype && !GetClass()->HasAnyClassFlags(CLASS_Abstract))
+    {
+        Context.AddError(FText::FromString(FString::Printf(TEXT("%s has no Archetype — assign a UFSEnemyArchetype data asset."), *GetClass()->GetName())));
+        result = EDataValidationResult::Invalid;
+    }
+
+    return result;
+}
+#endif
+
+void AFSEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UFSCrowdSubsystem* crowd{ GetWorld()->GetSubsystem<UFSCrowdSubsystem>() })
+        crowd->UnregisterEnemy(this);
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void AFSEnemy::Attack_Implementation()
 {
     bIsAttacking = true;
 
-    if (Player && MainAttack.Montage)
-        PlayAnimMontage(MainAttack.Montage);
+    if (!Player)
+        return;
+
+    if (UAnimMontage* attackMontage{ GetArchetype()->MainAttack.ResolveMontage() })
+    {
+        PlayAnimMontage(attackMontage);
+        HitboxComponent->StartTimeline(attackMontage);
+    }
+}
+
+void AFSEnemy::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+    // Called on class defaults during the arena preload — before BeginPlay's check could catch a missing archetype
+    if (!Archetype)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[Enemy] %s has no Archetype — its assets are not preloaded."), *GetClass()->GetName());
+        return;
+    }
+
+    Archetype->GatherPreloadAssets(OutAssets);
+
+    if (HitFeedbackComponent)
+        HitFeedbackComponent->GatherPreloadAssets(OutAssets);
 }
 
 void AFSEnemy::HandleOnMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 {
-    if (Montage == MainAttack.Montage)
+    if (Montage && Montage == GetArchetype()->MainAttack.Montage.Get())
         bIsAttacking = false;
     else
         bCanAttack = true;
@@ -62,7 +121,8 @@ void AFSEnemy::HandleOnMontageEnded(UAnimMontage* Montage, bool bInterrupted)
 
 void AFSEnemy::DisplayLockedOnWidget(bool bShowWidget)
 {
-    LockOnWidget->SetVisibility(bShowWidget);
+    if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+        markers->SetLockOnMarkerVisible(this, bShowWidget);
 }
 
 void AFSEnemy::DisplayHealthBarWidget(bool bShowWidget)
@@ -78,13 +138,15 @@ void AFSEnemy::DisplayAllWidgets(bool bShowWidget)
 
 void AFSEnemy::HandleOnHitLanded(AActor* hitActor, const FVector& hitLocation)
 {
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_EnemyHandleOnHitLanded);
+
     IFSDamageable* hitActorDamageable{ Cast<IFSDamageable>(hitActor) };
     if (!hitActor || !hitActorDamageable || (hitActorDamageable && hitActorDamageable->GetHealthComponent()->IsDead()))
         return;
 
     HitFeedbackComponent->OnLandHit(hitLocation);
 
-    hitActorDamageable->NotifyHitReceived(this, MainAttack);
+    hitActorDamageable->NotifyHitReceived(this, GetArchetype()->MainAttack);
 }
 
 void AFSEnemy::HandleOnHitReceived(AActor* instigatorActor, const FAttackData& usedAttack)
@@ -93,15 +155,20 @@ void AFSEnemy::HandleOnHitReceived(AActor* instigatorActor, const FAttackData& u
     if (instigatorActor->IsA<AFSEnemy>())
         return;
 
+    // Knockback and air stall need the full simulation
+    LastHitReceivedTime = GetWorld()->GetTimeSeconds();
+    SetReducedMovement(false);
+
     HitFeedbackComponent->OnReceiveHit(instigatorActor->GetActorLocation(), usedAttack.KnockbackForce, usedAttack.KnockbackUpForce);
     HealthComponent->ReceiveDamage(usedAttack.Damage, instigatorActor);
 
-    if (usedAttack.AttackContext == EAttackDataContext::Air && (GetCharacterMovement()->IsFalling() || GetCharacterMovement()->IsFlying()))
+    if (usedAttack.AttackContext == EAttackDataContext::Air && GetCharacterMovement<UFSCharacterMovementComponent>()->IsAirborne())
         StartAirStall(usedAttack.ComboWindowDuration);
 }
 
 void AFSEnemy::NotifyHitReceived(AActor* instigator, const FAttackData& usedAttack)
 {
+    FS_INC_COUNTER(DelegateBroadcasts);
     OnHitReceived.Broadcast(instigator, usedAttack);
 }
 
@@ -125,25 +192,91 @@ void AFSEnemy::HandleOnDeath()
 
     GetMesh()->GetAnimInstance()->StopAllMontages(0.3f);
 
+    // Corpses are no longer part of the crowd
+    if (UFSCrowdSubsystem* crowd{ GetWorld()->GetSubsystem<UFSCrowdSubsystem>() })
+        crowd->UnregisterEnemy(this);
+
     // TODO: Spawn loot/pickups
     OnEnemyDeath.Broadcast(this);
 
     SetLifeSpan(destroyDelay);
 }
 
+void AFSEnemy::SetReducedMovement(bool bReduced)
+{
+    UCharacterMovementComponent* movement{ GetCharacterMovement() };
+
+    // The movement component leaves NavWalking by itself when launched or off the navmesh
+    if (bReducedMovement && movement->MovementMode != MOVE_NavWalking)
+    {
+        movement->SetComponentTickInterval(0.f);
+        bReducedMovement = false;
+    }
+
+    if (bReduced == bReducedMovement)
+        return;
+
+    if (bReduced)
+    {
+        if (movement->MovementMode != MOVE_Walking)
+            return;
+
+        // Falls back to walking by itself when there is no navmesh under the enemy
+        movement->SetMovementMode(MOVE_NavWalking);
+        if (movement->MovementMode != MOVE_NavWalking)
+            return;
+
+        movement->SetComponentTickInterval(reducedMovementTickInterval);
+    }
+    else
+    {
+        if (movement->MovementMode == MOVE_NavWalking)
+            movement->SetMovementMode(MOVE_Walking);
+
+        movement->SetComponentTickInterval(0.f);
+    }
+
+    bReducedMovement = bReduced;
+}
+
+void AFSEnemy::UpdateMovementSmoothing(float DeltaTime)
+{
+    const FVector location{ GetActorLocation() };
+    const float yaw{ static_cast<float>(GetActorRotation().Yaw) };
+
+    // The capsule moved on a reduced movement tick — keep the mesh where it was rendered and start the catch-up
+    if (bReducedMovement && (!location.Equals(LastSmoothedLocation) || !FMath::IsNearlyEqual(yaw, LastSmoothedYaw)))
+    {
+        SmoothingLocationOffset += LastSmoothedLocation - location;
+        SmoothingYawOffset += FRotator::NormalizeAxis(LastSmoothedYaw - yaw);
+        SmoothingTimeRemaining = reducedMovementTickInterval;
+    }
+
+    LastSmoothedLocation = location;
+    LastSmoothedYaw = yaw;
+
+    if (SmoothingTimeRemaining <= 0.f)
+        return;
+
+    // Linear: the remaining offset is consumed in proportion of the remaining time
+    const float alpha{ FMath::Min(DeltaTime / SmoothingTimeRemaining, 1.f) };
+    SmoothingTimeRemaining -= DeltaTime;
+    SmoothingLocationOffset *= 1.f - alpha;
+    SmoothingYawOffset *= 1.f - alpha;
+
+    if (SmoothingTimeRemaining <= 0.f)
+    {
+        SmoothingLocationOffset = FVector::ZeroVector;
+        SmoothingYawOffset = 0.f;
+    }
+
+    const FQuat yawOffset{ FRotator(0.f, SmoothingYawOffset, 0.f).Quaternion() };
+    GetMesh()->SetRelativeLocationAndRotation(
+        yawOffset.RotateVector(GetBaseTranslationOffset()) + GetActorQuat().UnrotateVector(SmoothingLocationOffset),
+        yawOffset * GetBaseRotationOffset());
+}
+
 void AFSEnemy::StartAirStall(float airStallDuration)
 {
-    TWeakObjectPtr movementComp{ MakeWeakObjectPtr(GetCharacterMovement()) };
-    movementComp->SetMovementMode(EMovementMode::MOVE_Flying);
-
-    GetWorld()->GetTimerManager().SetTimer(
-        AirStallTimer,
-        [movementComp]()
-        {
-            if (movementComp.IsValid())
-                movementComp->SetMovementMode(EMovementMode::MOVE_Falling);
-        },
-        airStallDuration,
-        false
-    );
+    GetCharacterMovement<UFSCharacterMovementComponent>()->StartAirJuggle(airStallDuration);
 }
\ No newline at end of file
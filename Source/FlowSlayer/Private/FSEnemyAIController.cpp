@@ -1,4 +1,5 @@
 #include "FSEnemyAIController.h"
+#include "FlowSlayerStats.h"
 
 AFSEnemyAIController::AFSEnemyAIController()
 {
@@ -35,17 +36,11 @@ void AFSEnemyAIController::OnMoveToTargetCompleted(FAIRequestID RequestID, const
         OwnedEnemy->Attack();
 }
 
-void AFSEnemyAIController::Tick(float DeltaTime)
-{
-    Super::Tick(DeltaTime);
-
-    if (OwnedEnemy && !OwnedEnemy->IsAttacking() && !OwnedEnemy->GetHealthComponent()->IsDead() && OwnedEnemy->CanAttack())
-        FollowPlayer();
-}
-
 void AFSEnemyAIController::FollowPlayer()
 {
-    if (!PlayerRef)
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_AIFollowPlayer);
+
+    if (!PlayerRef || !OwnedEnemy)
         return;
 
     EPathFollowingStatus::Type Status{ GetMoveStatus() };
@@ -0,0 +1,7 @@
+#include "FSEnemyArchetype.h"
+
+void UFSEnemyArchetype::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	if (!MainAttack.Montage.IsNull())
+		OutAssets.AddUnique(MainAttack.Montage.ToSoftObjectPath());
+}
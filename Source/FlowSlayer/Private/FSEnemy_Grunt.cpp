@@ -1,6 +1,7 @@
 #include "FSEnemy_Grunt.h"
 
-AFSEnemy_Grunt::AFSEnemy_Grunt()
+AFSEnemy_Grunt::AFSEnemy_Grunt(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 }
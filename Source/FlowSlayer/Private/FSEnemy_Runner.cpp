@@ -1,10 +1,19 @@
 #include "FSEnemy_Runner.h"
 
-AFSEnemy_Runner::AFSEnemy_Runner()
+AFSEnemy_Runner::AFSEnemy_Runner(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 }
 
+void AFSEnemy_Runner::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	Super::GatherPreloadAssets(OutAssets);
+
+	if (ProjectileClass)
+		ProjectileClass->GetDefaultObject<AFSProjectile>()->GatherPreloadAssets(OutAssets);
+}
+
 void AFSEnemy_Runner::BeginPlay()
 {
 	Super::BeginPlay();
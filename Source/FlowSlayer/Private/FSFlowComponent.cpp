@@ -1,110 +1,96 @@
 #include "FSFlowComponent.h"
+#include "FlowSlayerStats.h"
+
+namespace
+{
+	/** Delay added past an exact tier crossing so the evaluation lands strictly below the boundary */
+	constexpr double TierCrossingEpsilon{ 0.001 };
+}
 
 UFSFlowComponent::UFSFlowComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 
-	FlowChanged.AddUniqueDynamic(this, &UFSFlowComponent::OnFlowChanged);
 	FlowTierChanged.AddUniqueDynamic(this, &UFSFlowComponent::OnFlowTierChanged);
 }
 
-
-void UFSFlowComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UFSFlowComponent::BeginPlay()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Super::BeginPlay();
 
-	if (bIsDecaying)
-		RemoveFlow(DecayRate * DeltaTime);
+	if (UFSStatsComponent* stats{ GetOwner()->FindComponentByClass<UFSStatsComponent>() })
+	{
+		DecayRateStat = stats->GetAggregate(EUpgradeStat::FlowDecayRate);
+		FlowGainStat = stats->GetAggregate(EUpgradeStat::FlowGainPerHit);
+		stats->OnStatChanged.AddUObject(this, &UFSFlowComponent::HandleOnStatChanged);
+	}
+
+	CurrentDecayRate = FMath::Max(0.f, DecayRateStat->Apply(DecayRate));
+	AnchorTime = GetNow();
+	DecayStartTime = AnchorTime;
+
+	if (bInfiniteFlow)
+		AddFlow(MaxFlow);
 }
 
-void UFSFlowComponent::HandleOnHitLanded(AActor* actorHit, const FVector& hitLocation, float damageAmount, float flowReward)
+void UFSFlowComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	AddFlow(flowReward * FlowGainMultiplier);
+	if (UWorld* world{ GetWorld() })
+	{
+		world->GetTimerManager().ClearTimer(TierCrossingTimer);
+		world->GetTimerManager().ClearTimer(DecayNotifyTimer);
+		world->GetTimerManager().ClearTimer(PendingNotifyTimer);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
-bool UFSFlowComponent::HasEnoughFlow(float flowCost) const
+void UFSFlowComponent::HandleOnHitLanded(AActor* actorHit, const FVector& hitLocation, float damageAmount, float flowReward)
 {
-	return CurrentFlow >= flowCost;
+	AddFlow(flowReward * FMath::Max(0.f, FlowGainStat->Apply(1.f)));
 }
 
-void UFSFlowComponent::OnFlowChanged(float currentFlow, float flowMax)
+bool UFSFlowComponent::HasEnoughFlow(float flowCost) const
 {
-	EFlowTier newTier{ GetFlowTier() };
-	if (newTier == CurrentTier)
-		return;
-
-	FlowTierChanged.Broadcast(newTier, CurrentTier);
+	return GetCurrentFlow() >= flowCost;
 }
 
 void UFSFlowComponent::OnFlowTierChanged(EFlowTier newTier, EFlowTier oldTier)
 {
 	CurrentTier = newTier;
 
-	if (CurrentTier == EFlowTier::Max)
-	{
-		GetWorld()->GetTimerManager().ClearTimer(DecayGraceTimer);
-		bIsDecaying = false;
-
-		TWeakObjectPtr<UFSFlowComponent> weakThis{ MakeWeakObjectPtr(this) };
-		weakThis->GetWorld()->GetTimerManager().SetTimer(
-			ImmunityTimer,
-			[weakThis]() { 	
-				weakThis->GetWorld()->GetTimerManager().SetTimer(
-				weakThis->DecayGraceTimer,
-				[weakThis]() 
-					{ 
-						if (weakThis.IsValid())
-							weakThis->bIsDecaying = true;
-					},
-				weakThis->DecayGracePeriod,
-				false
-			); },
-			weakThis->ImmunityDuration,
-			false
-		);
-	}
-}
-
-void UFSFlowComponent::BeginPlay()
-{
-	Super::BeginPlay();
+	if (CurrentTier != EFlowTier::Max)
+		return;
 
-	if (bInfiniteFlow)
-		AddFlow(MaxFlow);
+	// Entering Max tier: flow is protected for ImmunityDuration, then the usual grace period applies
+	Rebase();
+	ImmunityEndTime = GetNow() + ImmunityDuration;
+	DecayStartTime = ImmunityEndTime + DecayGracePeriod;
+	ScheduleDecayEvents();
 }
 
 void UFSFlowComponent::AddFlow(float amount)
 {
-	CurrentFlow = FMath::Clamp(CurrentFlow + amount, 0.f, MaxFlow);
+	Rebase();
+	AnchorFlow = FMath::Clamp(AnchorFlow + amount, 0.f, MaxFlow);
 
-	FlowChanged.Broadcast(CurrentFlow, MaxFlow);
+	// During immunity, the immunity window is in charge of the decay start
+	// Otherwise stop any active decay and reset the grace period
+	if (!IsImmune())
+		DecayStartTime = AnchorTime + DecayGracePeriod;
 
-	// During immunity, the ImmunityTimer is in charge of restarting the decay grace period
-	if (GetWorld()->GetTimerManager().IsTimerActive(ImmunityTimer))
-		return;
-
-	// Stop any active decay and reset the grace period
-	bIsDecaying = false;
-	GetWorld()->GetTimerManager().ClearTimer(DecayGraceTimer);
-	GetWorld()->GetTimerManager().SetTimer(
-		DecayGraceTimer,
-		[this]() { bIsDecaying = true; },
-		DecayGracePeriod,
-		false
-	);
+	HandleFlowStateChanged();
 }
 
 void UFSFlowComponent::RemoveFlow(float amount)
 {
-	if (GetWorld()->GetTimerManager().IsTimerActive(ImmunityTimer) || bInfiniteFlow)
+	if (IsImmune() || bInfiniteFlow)
 		return;
 
-	CurrentFlow = FMath::Clamp(CurrentFlow - amount, 0.f, MaxFlow);
+	Rebase();
+	AnchorFlow = FMath::Clamp(AnchorFlow - amount, 0.f, MaxFlow);
 
-	FlowChanged.Broadcast(CurrentFlow, MaxFlow);
-
-	if (CurrentFlow <= 0.f)
-		bIsDecaying = false;
+	HandleFlowStateChanged();
 }
 
 void UFSFlowComponent::ConsumeFlow(float amount)
@@ -132,33 +118,165 @@ EFlowTier UFSFlowComponent::GetFlowTier() const
 		return EFlowTier::Max;
 }
 
+float UFSFlowComponent::GetCurrentFlow() const
+{
+	return EvaluateFlow(GetNow());
+}
+
 float UFSFlowComponent::GetFlowRatio() const
 {
-	return CurrentFlow / MaxFlow;
+	return GetCurrentFlow() / MaxFlow;
+}
+
+double UFSFlowComponent::GetNow() const
+{
+	UWorld* world{ GetWorld() };
+	return world ? world->GetTimeSeconds() : 0.0;
+}
+
+float UFSFlowComponent::EvaluateFlow(double Time) const
+{
+	if (bInfiniteFlow)
+		return AnchorFlow;
+
+	double decayFrom{ FMath::Max(AnchorTime, DecayStartTime) };
+	if (Time <= decayFrom)
+		return AnchorFlow;
+
+	return FMath::Max(0.f, AnchorFlow - CurrentDecayRate * static_cast<float>(Time - decayFrom));
+}
+
+void UFSFlowComponent::Rebase()
+{
+	double now{ GetNow() };
+	AnchorFlow = EvaluateFlow(now);
+	AnchorTime = now;
+}
+
+void UFSFlowComponent::UpdateFlowTier()
+{
+	EFlowTier newTier{ GetFlowTier() };
+	if (newTier == CurrentTier)
+		return;
+
+	FlowTierChanged.Broadcast(newTier, CurrentTier);
 }
 
-void UFSFlowComponent::HandleOnUpgradeSelected(const FUpgradeData& Upgrade)
+void UFSFlowComponent::ScheduleDecayEvents()
 {
-	auto ApplyValue = [&Upgrade](float& Stat)
+	FTimerManager& timerManager{ GetWorld()->GetTimerManager() };
+	timerManager.ClearTimer(TierCrossingTimer);
+
+	const bool bWillDecay{ !bInfiniteFlow && CurrentDecayRate > 0.f && AnchorFlow > 0.f };
+	if (!bWillDecay)
 	{
-		if (Upgrade.ValueType == EUpgradeValueType::Additive)
-			Stat += Upgrade.Value;
-		else
-			Stat *= Upgrade.Value;
-	};
+		timerManager.ClearTimer(DecayNotifyTimer);
+		return;
+	}
+
+	double now{ GetNow() };
+	double decayFrom{ FMath::Max(now, DecayStartTime) };
 
-	switch (Upgrade.Stat)
+	// Next tier change caused by decay = flow dropping below the lower bound of the current tier
+	// (nothing to schedule in None — reaching 0 is not a tier change)
+	if (CurrentTier != EFlowTier::None)
 	{
-	case EUpgradeStat::FlowDecayRate:
-		ApplyValue(DecayRate);
-		DecayRate = FMath::Max(0.f, DecayRate);
-		break;
-	case EUpgradeStat::FlowGainPerHit:
-		ApplyValue(FlowGainMultiplier);
-		FlowGainMultiplier = FMath::Max(0.f, FlowGainMultiplier);
-		break;
-	default:
-		break;
+		static constexpr float tierLowerBounds[]{ 0.f, 0.25f, 0.50f, 0.75f, 1.00f };
+		float lowerBound{ tierLowerBounds[static_cast<int32>(CurrentTier)] * MaxFlow };
+		double crossingTime{ decayFrom + (EvaluateFlow(now) - lowerBound) / CurrentDecayRate };
+
+		TWeakObjectPtr<UFSFlowComponent> weakThis{ MakeWeakObjectPtr(this) };
+		FS_INC_COUNTER(TimersCreated);
+		timerManager.SetTimer(
+			TierCrossingTimer,
+			[weakThis]()
+			{
+				if (!weakThis.IsValid())
+					return;
+
+				weakThis->UpdateFlowTier();
+				weakThis->ScheduleDecayEvents();
+			},
+			static_cast<float>(FMath::Max(crossingTime - now, 0.0) + TierCrossingEpsilon),
+			false
+		);
 	}
+
+	// UI follows the decaying bar at FlowNotifyRate, starting when decay starts
+	TWeakObjectPtr<UFSFlowComponent> weakThis{ MakeWeakObjectPtr(this) };
+	FS_INC_COUNTER(TimersCreated);
+	timerManager.SetTimer(
+		DecayNotifyTimer,
+		[weakThis]()
+		{
+			if (!weakThis.IsValid())
+				return;
+
+			weakThis->BroadcastFlowChanged();
+
+			if (weakThis->GetCurrentFlow() <= 0.f)
+				weakThis->GetWorld()->GetTimerManager().ClearTimer(weakThis->DecayNotifyTimer);
+		},
+		1.f / FlowNotifyRate,
+		true,
+		static_cast<float>(FMath::Max(decayFrom - now, 0.0) + 1.0 / FlowNotifyRate)
+	);
 }
 
+void UFSFlowComponent::NotifyFlowChanged()
+{
+	FTimerManager& timerManager{ GetWorld()->GetTimerManager() };
+
+	double now{ GetNow() };
+	double interval{ 1.0 / FlowNotifyRate };
+	double sinceLast{ now - LastFlowNotifyTime };
+
+	if (LastFlowNotifyTime < 0.0 || sinceLast >= interval)
+	{
+		timerManager.ClearTimer(PendingNotifyTimer);
+		BroadcastFlowChanged();
+		return;
+	}
+
+	// Held back — a single pending broadcast carries the latest value when the window reopens
+	if (timerManager.IsTimerActive(PendingNotifyTimer))
+		return;
+
+	TWeakObjectPtr<UFSFlowComponent> weakThis{ MakeWeakObjectPtr(this) };
+	FS_INC_COUNTER(TimersCreated);
+	timerManager.SetTimer(
+		PendingNotifyTimer,
+		[weakThis]()
+		{
+			if (weakThis.IsValid())
+				weakThis->BroadcastFlowChanged();
+		},
+		static_cast<float>(interval - sinceLast),
+		false
+	);
+}
+
+void UFSFlowComponent::BroadcastFlowChanged()
+{
+	LastFlowNotifyTime = GetNow();
+	FS_INC_COUNTER(DelegateBroadcasts);
+	FlowChanged.Broadcast(GetCurrentFlow(), MaxFlow);
+}
+
+void UFSFlowComponent::HandleFlowStateChanged()
+{
+	UpdateFlowTier();
+	ScheduleDecayEvents();
+	NotifyFlowChanged();
+}
+
+void UFSFlowComponent::HandleOnStatChanged(EUpgradeStat Stat)
+{
+	if (Stat != EUpgradeStat::FlowDecayRate)
+		return;
+
+	// The elapsed part of the decay keeps the old rate — only the future uses the new one
+	Rebase();
+	CurrentDecayRate = FMath::Max(0.f, DecayRateStat->Apply(DecayRate));
+	ScheduleDecayEvents();
+}
@@ -0,0 +1,169 @@
+#include "FSHUDModel.h"
+#include "FSActorRegistrySubsystem.h"
+#include "FSCombatComponent.h"
+#include "FSStatsComponent.h"
+#include "HealthComponent.h"
+#include "ProgressionComponent.h"
+#include "RunManager.h"
+
+void UFSHUDModel::Initialize(APawn* Player)
+{
+	checkf(Player, TEXT("FATAL: [HUDModel] Initialized without a player."));
+
+	HealthComponent = Player->FindComponentByClass<UHealthComponent>();
+	FlowComponent = Player->FindComponentByClass<UFSFlowComponent>();
+	CombatComponent = Player->FindComponentByClass<UFSCombatComponent>();
+	ProgressionComponent = Player->FindComponentByClass<UProgressionComponent>();
+
+	if (HealthComponent)
+	{
+		HealthComponent->OnDamageReceived.AddUniqueDynamic(this, &UFSHUDModel::HandleOnDamageReceived);
+		HealthComponent->OnHeal.AddUniqueDynamic(this, &UFSHUDModel::HandleOnHeal);
+	}
+
+	if (UFSStatsComponent* stats{ Player->FindComponentByClass<UFSStatsComponent>() })
+		stats->OnStatChanged.AddUObject(this, &UFSHUDModel::HandleOnStatChanged);
+
+	if (CombatComponent)
+	{
+		CombatComponent->OnComboCounterStarted.AddUniqueDynamic(this, &UFSHUDModel::HandleOnComboCounterStarted);
+		CombatComponent->OnComboCountChanged.AddUniqueDynamic(this, &UFSHUDModel::HandleOnComboCountChanged);
+		CombatComponent->OnComboCounterEnded.AddUniqueDynamic(this, &UFSHUDModel::HandleOnComboCounterEnded);
+	}
+
+	if (ProgressionComponent)
+	{
+		ProgressionComponent->OnXPGained.AddUniqueDynamic(this, &UFSHUDModel::HandleOnXPGained);
+		ProgressionComponent->OnLevelUp.AddUniqueDynamic(this, &UFSHUDModel::HandleOnLevelUp);
+	}
+
+	// The RunManager may begin play after the player
+	if (UFSActorRegistrySubsystem* registry{ Player->GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() })
+	{
+		registry->OnRunManagerRegistered.AddUObject(this, &UFSHUDModel::BindRunManager);
+		BindRunManager(registry->GetRunManager());
+	}
+
+	RefreshHealth();
+	RefreshProgression();
+	RefreshPolledFields();
+
+	// First consume pushes everything
+	DirtyFields = (1 << static_cast<int32>(EFSHUDField::Count)) - 1;
+}
+
+int32 UFSHUDModel::ConsumeDirtyFields()
+{
+	RefreshPolledFields();
+
+	const int32 dirtyFields{ DirtyFields };
+	DirtyFields = 0;
+	return dirtyFields;
+}
+
+void UFSHUDModel::RefreshPolledFields()
+{
+	if (FlowComponent)
+	{
+		const float flow{ FlowComponent->GetCurrentFlow() };
+		if (!FMath::IsNearlyEqual(flow, Snapshot.Flow, 0.01f))
+		{
+			Snapshot.Flow = flow;
+			Snapshot.FlowRatio = FlowComponent->GetFlowRatio();
+			Snapshot.FlowTier = FlowComponent->GetFlowTier();
+			MarkDirty(EFSHUDField::Flow);
+		}
+	}
+
+	if (CombatComponent && Snapshot.bComboActive)
+	{
+		Snapshot.ComboTimeRatio = CombatComponent->GetComboTimeRatio();
+		MarkDirty(EFSHUDField::Combo);
+	}
+}
+
+void UFSHUDModel::RefreshHealth()
+{
+	if (!HealthComponent)
+		return;
+
+	Snapshot.Health = HealthComponent->GetCurrentHealth();
+	Snapshot.MaxHealth = HealthComponent->GetMaxHealth();
+	MarkDirty(EFSHUDField::Health);
+}
+
+void UFSHUDModel::RefreshProgression()
+{
+	if (!ProgressionComponent)
+		return;
+
+	Snapshot.Level = ProgressionComponent->GetCurrentLevel();
+	Snapshot.XP = ProgressionComponent->GetCurrentXP();
+	Snapshot.XPRatio = ProgressionComponent->GetXPRatio();
+	MarkDirty(EFSHUDField::Progression);
+}
+
+void UFSHUDModel::BindRunManager(ARunManager* RunManager)
+{
+	if (!RunManager)
+		return;
+
+	RunManager->OnScoreChanged.AddUniqueDynamic(this, &UFSHUDModel::HandleOnScoreChanged);
+	HandleOnScoreChanged(RunManager->GetScore());
+}
+
+// ==================== EVENT HANDLERS ====================
+
+void UFSHUDModel::HandleOnDamageReceived(AActor* instigator, float damageAmount, float currentHealth, float maxHealth)
+{
+	Snapshot.Health = currentHealth;
+	Snapshot.MaxHealth = maxHealth;
+	MarkDirty(EFSHUDField::Health);
+}
+
+void UFSHUDModel::HandleOnHeal()
+{
+	RefreshHealth();
+}
+
+void UFSHUDModel::HandleOnStatChanged(EUpgradeStat Stat)
+{
+	if (Stat == EUpgradeStat::MaxHealth)
+		RefreshHealth();
+}
+
+void UFSHUDModel::HandleOnComboCounterStarted()
+{
+	Snapshot.bComboActive = true;
+	MarkDirty(EFSHUDField::Combo);
+}
+
+void UFSHUDModel::HandleOnComboCountChanged(int32 HitCount)
+{
+	Snapshot.ComboCount = HitCount;
+	MarkDirty(EFSHUDField::Combo);
+}
+
+void UFSHUDModel::HandleOnComboCounterEnded()
+{
+	Snapshot.bComboActive = false;
+	Snapshot.ComboCount = 0;
+	Snapshot.ComboTimeRatio = 0.f;
+	MarkDirty(EFSHUDField::Combo);
+}
+
+void UFSHUDModel::HandleOnXPGained(int32 Amount, int32 NewTotal)
+{
+	RefreshProgression();
+}
+
+void UFSHUDModel::HandleOnLevelUp(int32 NewLevel)
+{
+	RefreshProgression();
+}
+
+void UFSHUDModel::HandleOnScoreChanged(int32 NewScore)
+{
+	Snapshot.Score = NewScore;
+	MarkDirty(EFSHUDField::Score);
+}
@@ -0,0 +1,67 @@
+#include "FSHUDWidget.h"
+#include "FlowSlayerStats.h"
+#include "Components/RetainerBox.h"
+
+static TAutoConsoleVariable<bool> CVarHUDThrottle(
+	TEXT("fs.HUD.Throttle"),
+	true,
+	TEXT("Whether the HUD only flushes changed fields and re-renders their regions — 0 flushes and re-renders every region each frame (A/B baseline for stat UMG / stat Slate)."));
+
+void UFSHUDWidget::SetHUDModel(UFSHUDModel* InHUDModel)
+{
+	HUDModel = InHUDModel;
+	LastFlushTime = 0.0;
+}
+
+void UFSHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (!HUDModel)
+		return;
+
+	// Real time — the HUD keeps its rate while the world is slowed down by hitstop
+	const double now{ FPlatformTime::Seconds() };
+	if (FlushRate > 0.f && now - LastFlushTime < 1.0 / FlushRate)
+		return;
+
+	LastFlushTime = now;
+	Flush();
+}
+
+void UFSHUDWidget::Flush()
+{
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_HUDFlush);
+
+	int32 dirtyFields{ HUDModel->ConsumeDirtyFields() };
+	if (!CVarHUDThrottle.GetValueOnGameThread())
+		dirtyFields = UFSHUDModel::FieldBit(EFSHUDField::Count) - 1;
+
+	if (dirtyFields == 0)
+		return;
+
+	for (int32 i{ 0 }; i < static_cast<int32>(EFSHUDField::Count); ++i)
+	{
+		const EFSHUDField field{ static_cast<EFSHUDField>(i) };
+		if (!UFSHUDModel::IsFieldDirty(dirtyFields, field))
+			continue;
+
+		if (URetainerBox* region{ GetRegion(field) })
+			region->RequestRender();
+	}
+
+	OnHUDFlushed(HUDModel->GetSnapshot(), dirtyFields);
+}
+
+URetainerBox* UFSHUDWidget::GetRegion(EFSHUDField Field) const
+{
+	switch (Field)
+	{
+	case EFSHUDField::Health:      return HealthRegion;
+	case EFSHUDField::Flow:        return FlowRegion;
+	case EFSHUDField::Combo:       return ComboRegion;
+	case EFSHUDField::Progression: return ProgressionRegion;
+	case EFSHUDField::Score:       return ProgressionRegion;
+	default:                       return nullptr;
+	}
+}
@@ -0,0 +1,74 @@
+#include "FSHitboxTimelineSubsystem.h"
+#include "FlowSlayerStats.h"
+#include "AnimNotifyState_Hitbox.h"
+#include "Animation/AnimMontage.h"
+#include "Engine/World.h"
+
+FFSHitboxTimeline FFSHitboxTimeline::Compile(const UAnimMontage* Montage)
+{
+	FFSHitboxTimeline timeline;
+	if (!Montage)
+		return timeline;
+
+	for (const FAnimNotifyEvent& notifyEvent : Montage->Notifies)
+	{
+		const UAnimNotifyState_Hitbox* hitboxNotify{ Cast<UAnimNotifyState_Hitbox>(notifyEvent.NotifyStateClass) };
+		if (!hitboxNotify)
+			continue;
+
+		FFSHitboxWindow& window{ timeline.Windows.AddDefaulted_GetRef() };
+		window.StartTime = notifyEvent.GetTriggerTime();
+		window.EndTime = notifyEvent.GetEndTriggerTime();
+		window.Profile = hitboxNotify->GetHitboxProfile();
+	}
+
+	timeline.Windows.Sort([](const FFSHitboxWindow& A, const FFSHitboxWindow& B) { return A.StartTime < B.StartTime; });
+	return timeline;
+}
+
+TSharedRef<const FFSHitboxTimeline> UFSHitboxTimelineSubsystem::GetTimeline(const UAnimMontage* Montage)
+{
+	const TObjectKey<UAnimMontage> montageKey{ Montage };
+	if (const TSharedRef<const FFSHitboxTimeline>* timeline{ Timelines.Find(montageKey) })
+		return *timeline;
+
+	LLM_SCOPE_BYTAG(FlowSlayer_CombatData);
+
+	TSharedRef<const FFSHitboxTimeline> timeline{ MakeShared<const FFSHitboxTimeline>(FFSHitboxTimeline::Compile(Montage)) };
+	if (Montage)
+		Timelines.Add(montageKey, timeline);
+
+	return timeline;
+}
+
+void UFSHitboxTimelineSubsystem::ForEachTimeline(TFunctionRef<void(const UAnimMontage* Montage, const FFSHitboxTimeline& Timeline)> Visitor) const
+{
+	for (const TPair<TObjectKey<UAnimMontage>, TSharedRef<const FFSHitboxTimeline>>& entry : Timelines)
+	{
+		if (const UAnimMontage* montage{ entry.Key.ResolveObjectPtr() })
+			Visitor(montage, *entry.Value);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+/** fs.Hitbox.DumpTimelines — logs every compiled hitbox timeline of the current world */
+static FAutoConsoleCommandWithWorld DumpHitboxTimelinesCommand(
+	TEXT("fs.Hitbox.DumpTimelines"),
+	TEXT("Logs the compiled hitbox timeline of every montage played so far."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		const UFSHitboxTimelineSubsystem* subsystem{ World ? World->GetSubsystem<UFSHitboxTimelineSubsystem>() : nullptr };
+		if (!subsystem)
+			return;
+
+		subsystem->ForEachTimeline([](const UAnimMontage* Montage, const FFSHitboxTimeline& Timeline)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[HitboxTimeline] %s — %d window(s)"), *GetNameSafe(Montage), Timeline.Windows.Num());
+			for (const FFSHitboxWindow& window : Timeline.Windows)
+			{
+				UE_LOG(LogTemp, Log, TEXT("[HitboxTimeline]   %.3f → %.3f  %s"), window.StartTime, window.EndTime,
+					*StaticEnum<EHitboxShape>()->GetNameStringByValue(static_cast<int64>(window.Profile.Shape)));
+			}
+		});
+	}));
+#endif
@@ -1,4 +1,6 @@
 #include "FSLockOnComponent.h"
+#include "FlowSlayerStats.h"
+#include "Engine/OverlapResult.h"
 
 UFSLockOnComponent::UFSLockOnComponent()
 {
@@ -26,6 +28,12 @@ void UFSLockOnComponent::TickComponent(float DeltaTime, ELevelTick TickType, FAc
 		UpdateLockOnCamera(DeltaTime);
 		LockOnValidCheck();
 	}
+
+	if (bAsyncTargetProbe)
+	{
+		TargetProbe.Poll(GetWorld());
+		TargetProbe.Request(GetWorld(), PlayerOwner->GetActorLocation(), LockOnDetectionRadius, ECC_Pawn, GetOwner());
+	}
 }
 
 // ==================== Core ====================
@@ -97,11 +105,13 @@ void UFSLockOnComponent::UpdateCameraFacingTarget(float deltaTime)
 
 bool UFSLockOnComponent::EngageLockOn()
 {
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_LockOnEngage);
+
 	if (!PlayerOwner)
 		return false;
 
-	TArray<FHitResult> outHits;
-	if (!FindTargetsInRadius(outHits))
+	TArray<AActor*> foundActors;
+	if (!FindTargetsInRadius(foundActors, EFSQueryLatency::OneFrame))
 		return false;
 
 	AController* Controller{ PlayerOwner->GetController() };
@@ -113,7 +123,7 @@ bool UFSLockOnComponent::EngageLockOn()
 	CameraForward.Z = 0;
 	CameraForward.Normalize();
 
-	CollectValidTargets(outHits);
+	CollectValidTargets(foundActors);
 
 	if (TargetsInLockOnRadius.IsEmpty())
 		return false;
@@ -127,7 +137,7 @@ bool UFSLockOnComponent::EngageLockOn()
 
 	CachedFocusableTarget->DisplayAllWidgets(true);
 
-	PrimaryComponentTick.SetTickFunctionEnable(true);
+	RefreshTickEnabled();
 	SetPlayerLockOnMovementMode(true);
 
 	OnLockOnStarted.Execute(CurrentLockedOnTarget);
@@ -140,12 +150,12 @@ void UFSLockOnComponent::SwitchLockOnTarget(float axisValueX)
 	if (!CurrentLockedOnTarget || GetWorld()->GetTimerManager().IsTimerActive(delaySwitchLockOnTimer))
 		return;
 
-	TArray<FHitResult> outHits;
-	if (!FindTargetsInRadius(outHits))
+	TArray<AActor*> foundActors;
+	if (!FindTargetsInRadius(foundActors, EFSQueryLatency::OneFrame))
 		return;
 
 	bool bLookingRight{ axisValueX > 0 };
-	AActor* BestTarget{ FindBestTargetInDirection(outHits, bLookingRight) };
+	AActor* BestTarget{ FindBestTargetInDirection(foundActors, bLookingRight) };
 
 	if (!BestTarget)
 		return;
@@ -155,6 +165,7 @@ void UFSLockOnComponent::SwitchLockOnTarget(float axisValueX)
 	SetCurrentTarget(BestTarget);
 	CachedFocusableTarget->DisplayAllWidgets(true);
 
+	FS_INC_COUNTER(TimersCreated);
 	GetWorld()->GetTimerManager().SetTimer(
 		delaySwitchLockOnTimer,
 		targetSwitchDelay,
@@ -174,7 +185,7 @@ void UFSLockOnComponent::DisengageLockOn()
 	SetCurrentTarget(nullptr);
 	bIsLockedOnEngaged = false;
 
-	PrimaryComponentTick.SetTickFunctionEnable(false);
+	RefreshTickEnabled();
 	SetPlayerLockOnMovementMode(false);
 
 	// Reset residual Roll accumulated by the lock-on camera interpolation
@@ -185,8 +196,29 @@ void UFSLockOnComponent::DisengageLockOn()
 	OnLockOnStopped.Broadcast();
 }
 
+void UFSLockOnComponent::OnAttackingStarted()
+{
+	bAttackWindowOpen = true;
+	RefreshTickEnabled();
+}
+
+void UFSLockOnComponent::OnAttackingEnded()
+{
+	bAttackWindowOpen = false;
+	RefreshTickEnabled();
+}
+
 // ==================== Helpers ====================
 
+void UFSLockOnComponent::RefreshTickEnabled()
+{
+	const bool bProbeNeeded{ bAsyncTargetProbe && (bIsLockedOnEngaged || bAttackWindowOpen) };
+	if (!bProbeNeeded)
+		TargetProbe.Reset();
+
+	PrimaryComponentTick.SetTickFunctionEnable(bIsLockedOnEngaged || bProbeNeeded);
+}
+
 bool UFSLockOnComponent::IsValidLockOnTarget(AActor* actor) const
 {
 	if (!actor)
@@ -222,43 +254,27 @@ void UFSLockOnComponent::SetPlayerLockOnMovementMode(bool bLockOnActive)
 	}
 }
 
-void UFSLockOnComponent::CollectValidTargets(const TArray<FHitResult>& hits)
+void UFSLockOnComponent::CollectValidTargets(const TArray<AActor*>& actors)
 {
-	TSet<AActor*> uniqueHitActors;
-	for (const FHitResult& hit : hits)
+	for (AActor* actor : actors)
 	{
-		AActor* HitActor{ hit.GetActor() };
-
-		if (uniqueHitActors.Contains(HitActor) || TargetsInLockOnRadius.Contains(HitActor))
-			continue;
-
-		uniqueHitActors.Add(HitActor);
-
-		if (IsValidLockOnTarget(HitActor))
-			TargetsInLockOnRadius.Add(HitActor);
+		if (!TargetsInLockOnRadius.Contains(actor) && IsValidLockOnTarget(actor))
+			TargetsInLockOnRadius.Add(actor);
 	}
 }
 
 AActor* UFSLockOnComponent::SwitchToNearestTarget()
 {
-	TArray<FHitResult> outHits;
-	if (!FindTargetsInRadius(outHits))
+	TArray<AActor*> foundActors;
+	if (!FindTargetsInRadius(foundActors, EFSQueryLatency::OneFrame))
 		return nullptr;
 
 	FVector PlayerLocation{ PlayerOwner->GetActorLocation() };
 	AActor* NearestTarget{ nullptr };
 	float SmallestDistance{ FLT_MAX };
 
-	TSet<AActor*> ProcessedActors;
-	for (const FHitResult& hit : outHits)
+	for (AActor* HitActor : foundActors)
 	{
-		AActor* HitActor{ hit.GetActor() };
-
-		if (ProcessedActors.Contains(HitActor))
-			continue;
-
-		ProcessedActors.Add(HitActor);
-
 		if (HitActor == CurrentLockedOnTarget || !IsValidLockOnTarget(HitActor))
 			continue;
 
@@ -310,7 +326,7 @@ AActor* UFSLockOnComponent::FindBestScoredTarget(const FVector& cameraForward) c
 	return BestTarget;
 }
 
-AActor* UFSLockOnComponent::FindBestTargetInDirection(const TArray<FHitResult>& hits, bool bLookingRight) const
+AActor* UFSLockOnComponent::FindBestTargetInDirection(const TArray<AActor*>& actors, bool bLookingRight) const
 {
 	FRotator ControlRotation{ PlayerOwner->GetController()->GetControlRotation() };
 	FVector CameraForward{ ControlRotation.Vector() };
@@ -325,16 +341,8 @@ AActor* UFSLockOnComponent::FindBestTargetInDirection(const TArray<FHitResult>&
 	AActor* BestTarget{ nullptr };
 	float SmallestAngle{ FLT_MAX };
 
-	TSet<AActor*> ProcessedActors;
-	for (const FHitResult& hit : hits)
+	for (AActor* HitActor : actors)
 	{
-		AActor* HitActor{ hit.GetActor() };
-
-		if (ProcessedActors.Contains(HitActor))
-			continue;
-
-		ProcessedActors.Add(HitActor);
-
 		if (HitActor == CurrentLockedOnTarget || !IsValidLockOnTarget(HitActor))
 			continue;
 
@@ -369,32 +377,34 @@ AActor* UFSLockOnComponent::FindBestTargetInDirection(const TArray<FHitResult>&
 	return BestTarget;
 }
 
-bool UFSLockOnComponent::FindTargetsInRadius(TArray<FHitResult>& outHits)
+bool UFSLockOnComponent::FindTargetsInRadius(TArray<AActor*>& outActors, EFSQueryLatency latency)
+{
+	return FindPawnsInRadius(LockOnDetectionRadius, outActors, latency);
+}
+
+bool UFSLockOnComponent::FindPawnsInRadius(float radius, TArray<AActor*>& outActors, EFSQueryLatency latency)
 {
 	if (!PlayerOwner)
 		return false;
 
-	FVector Start{ PlayerOwner->GetActorLocation() };
-	FVector End{ Start };
-
-	TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
-	ObjectTypes.Add(UEngineTypes::ConvertToObjectType(ECC_Pawn));
-
-	TArray<AActor*> ActorsToIgnore;
-	ActorsToIgnore.Add(GetOwner());
-
-	return UKismetSystemLibrary::SphereTraceMultiForObjects(
-		GetWorld(),
-		Start,
-		End,
-		LockOnDetectionRadius,
-		ObjectTypes,
-		false,
-		ActorsToIgnore,
-		EDrawDebugTrace::None,
-		outHits,
-		true
-	);
+	const FVector center{ PlayerOwner->GetActorLocation() };
+	if (latency == EFSQueryLatency::OneFrame && bAsyncTargetProbe && TargetProbe.GetActorsInRadius(GetWorld(), center, radius, outActors))
+		return !outActors.IsEmpty();
+
+	TArray<FOverlapResult> overlaps;
+	FCollisionQueryParams queryParams{ SCENE_QUERY_STAT(FSLockOnTargets), false, GetOwner() };
+
+	FS_INC_COUNTER(SceneQueries);
+	GetWorld()->OverlapMultiByObjectType(overlaps, center, FQuat::Identity, FCollisionObjectQueryParams(ECC_Pawn),
+		FCollisionShape::MakeSphere(radius), queryParams);
+
+	for (const FOverlapResult& overlap : overlaps)
+	{
+		if (AActor* actor{ overlap.GetActor() })
+			outActors.AddUnique(actor);
+	}
+
+	return !outActors.IsEmpty();
 }
 
 void UFSLockOnComponent::HidePreviousTargetWidgets()
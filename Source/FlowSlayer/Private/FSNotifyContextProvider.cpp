@@ -0,0 +1,25 @@
+#include "FSNotifyContextProvider.h"
+#include "FlowSlayerStats.h"
+#include "../FlowSlayerCharacter.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "FSCharacterMovementComponent.h"
+#include "MotionWarpingComponent.h"
+
+void FFSNotifyContext::Initialize(ACharacter* InCharacter)
+{
+	checkf(InCharacter, TEXT("FATAL: [NotifyContext] Initialized without a character."));
+
+	Character = InCharacter;
+	Movement = Cast<UFSCharacterMovementComponent>(InCharacter->GetCharacterMovement());
+	Combat = InCharacter->FindComponentByClass<UFSCombatComponent>();
+	Dash = InCharacter->FindComponentByClass<UDashComponent>();
+	LockOn = InCharacter->FindComponentByClass<UFSLockOnComponent>();
+	MotionWarping = InCharacter->FindComponentByClass<UMotionWarpingComponent>();
+	Player = Cast<AFlowSlayerCharacter>(InCharacter);
+}
+
+FFSNotifyContext* FFSNotifyContext::Get(const USkeletalMeshComponent* MeshComp)
+{
+	IFSNotifyContextProvider* provider{ MeshComp ? Cast<IFSNotifyContextProvider>(MeshComp->GetOwner()) : nullptr };
+	return provider ? &provider->GetNotifyContext() : nullptr;
+}
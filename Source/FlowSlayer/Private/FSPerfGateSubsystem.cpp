@@ -0,0 +1,530 @@
+#include "FSPerfGateSubsystem.h"
+#include "FlowSlayerStats.h"
+#include "FSActorRegistrySubsystem.h"
+#include "FSArenaManager.h"
+#include "FSCombatComponent.h"
+#include "FSCrowdSubsystem.h"
+#include "HealthComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+	/** Checked-in budgets file, relative to the project Config directory */
+	const TCHAR* BudgetsFileName{ TEXT("FlowSlayerPerfBudgets.json") };
+
+	/** Percentile compared to the budgets */
+	constexpr float BudgetPercentile{ 0.95f };
+
+	/** Exit code when a budget is exceeded */
+	constexpr uint8 ExitCodeBudgetExceeded{ 1 };
+
+	/** Exit code when the scenario could not run */
+	constexpr uint8 ExitCodeScenarioError{ 2 };
+
+	/** Soak enemies spawned per frame — spreads the spawn cost over the warmup */
+	constexpr int32 SoakSpawnsPerFrame{ 5 };
+
+	/** Headroom added to a measured p95 for the report's SuggestedBudget — absorbs run-to-run noise on one machine */
+	constexpr double SuggestedBudgetHeadroom{ 0.15 };
+}
+
+FString UFSPerfGateSubsystem::AutomationScenarioName;
+
+bool UFSPerfGateSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if UE_BUILD_SHIPPING
+	return false;
+#else
+	FString scenario;
+	return (!AutomationScenarioName.IsEmpty() || FParse::Value(FCommandLine::Get(), TEXT("FSPerfGate="), scenario))
+		&& Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UFSPerfGateSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!InWorld.IsGameWorld())
+		return;
+
+	if (!AutomationScenarioName.IsEmpty())
+		ScenarioName = AutomationScenarioName;
+	else
+		FParse::Value(FCommandLine::Get(), TEXT("FSPerfGate="), ScenarioName);
+
+	const TSharedPtr<FJsonObject> scenarios{ LoadScenarios() };
+	if (!scenarios || !ParseScenario(*scenarios, ScenarioName, Scenario) || !LoadBaselineReport() || !ApplyConsoleVariables())
+	{
+		RequestExit(ExitCodeScenarioError);
+		return;
+	}
+
+	for (TArray<float>& metricSamples : Samples)
+		metricSamples.Reserve(Scenario.SampleFrames);
+
+	FFlowSlayerFrameCounters::Get().Reset();
+	LastMallocCalls = GetMallocCalls();
+	bRunning = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[PerfGate] Running scenario '%s' — %d warmup + %d sampled frames."),
+		*ScenarioName, Scenario.WarmupFrames, Scenario.SampleFrames);
+}
+
+void UFSPerfGateSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bRunning)
+		return;
+
+	DriveScenario(DeltaTime);
+
+	// Counters and GGameThreadTime describe the previous frame — the first frame has nothing to report
+	if (FrameIndex >= Scenario.WarmupFrames && FrameIndex > 0)
+		SampleFrame();
+	else
+	{
+		FFlowSlayerFrameCounters::Get().Reset();
+		LastMallocCalls = GetMallocCalls();
+	}
+
+	++FrameIndex;
+
+	if (Samples[0].Num() >= Scenario.SampleFrames)
+		FinishScenario();
+}
+
+TStatId UFSPerfGateSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFSPerfGateSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== SCENARIO ====================
+
+TSharedPtr<FJsonObject> UFSPerfGateSubsystem::LoadScenarios()
+{
+	const FString budgetsPath{ FPaths::Combine(FPaths::ProjectConfigDir(), BudgetsFileName) };
+
+	FString fileContent;
+	if (!FFileHelper::LoadFileToString(fileContent, *budgetsPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Budgets file '%s' not found."), *budgetsPath);
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> root;
+	const TSharedRef<TJsonReader<>> reader{ TJsonReaderFactory<>::Create(fileContent) };
+	if (!FJsonSerializer::Deserialize(reader, root) || !root.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Budgets file '%s' is not valid JSON."), *budgetsPath);
+		return nullptr;
+	}
+
+	const TSharedPtr<FJsonObject>* scenarios{ nullptr };
+	if (!root->TryGetObjectField(TEXT("Scenarios"), scenarios))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Budgets file '%s' has no Scenarios object."), *budgetsPath);
+		return nullptr;
+	}
+
+	return *scenarios;
+}
+
+bool UFSPerfGateSubsystem::ParseScenario(const FJsonObject& Scenarios, const FString& InScenarioName, FFSPerfScenario& OutScenario)
+{
+	const TSharedPtr<FJsonObject>* scenarioObject{ nullptr };
+	if (!Scenarios.TryGetObjectField(InScenarioName, scenarioObject))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Scenario '%s' not found in %s."), *InScenarioName, BudgetsFileName);
+		return false;
+	}
+
+	const FJsonObject& json{ **scenarioObject };
+	json.TryGetNumberField(TEXT("WarmupFrames"), OutScenario.WarmupFrames);
+	json.TryGetNumberField(TEXT("SampleFrames"), OutScenario.SampleFrames);
+	json.TryGetBoolField(TEXT("StartArena"), OutScenario.bStartArena);
+	json.TryGetNumberField(TEXT("AttackInterval"), OutScenario.AttackInterval);
+	json.TryGetNumberField(TEXT("SoakEnemyCount"), OutScenario.SoakEnemyCount);
+	json.TryGetStringField(TEXT("Map"), OutScenario.Map);
+	json.TryGetBoolField(TEXT("Provisional"), OutScenario.bProvisional);
+
+	const TSharedPtr<FJsonObject>* consoleVariables{ nullptr };
+	if (json.TryGetObjectField(TEXT("ConsoleVariables"), consoleVariables))
+	{
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& variable : (*consoleVariables)->Values)
+			OutScenario.ConsoleVariables.Add(variable.Key, variable.Value->AsString());
+	}
+
+	OutScenario.SampleFrames = FMath::Max(1, OutScenario.SampleFrames);
+	OutScenario.AttackInterval = FMath::Max(0.05f, OutScenario.AttackInterval);
+
+	TArray<FString> attackNames;
+	json.TryGetStringArrayField(TEXT("AttackScript"), attackNames);
+	for (const FString& attackName : attackNames)
+	{
+		const int64 value{ StaticEnum<EAttackType>()->GetValueByNameString(attackName) };
+		if (value == INDEX_NONE)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[PerfGate] Unknown attack '%s' in scenario '%s'."), *attackName, *InScenarioName);
+			return false;
+		}
+
+		OutScenario.AttackScript.Add(static_cast<EAttackType>(value));
+	}
+
+	const TSharedPtr<FJsonObject>* budgets{ nullptr };
+	if (json.TryGetObjectField(TEXT("Budgets"), budgets) && !ParseMetricBudgets(**budgets, InScenarioName, OutScenario.Budgets))
+		return false;
+
+	if (json.TryGetStringField(TEXT("Baseline"), OutScenario.Baseline)
+		&& (OutScenario.Baseline == InScenarioName || !Scenarios.HasTypedField<EJson::Object>(OutScenario.Baseline)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Scenario '%s' has an invalid Baseline '%s'."), *InScenarioName, *OutScenario.Baseline);
+		return false;
+	}
+
+	const TSharedPtr<FJsonObject>* deltaBudgets{ nullptr };
+	if (json.TryGetObjectField(TEXT("DeltaBudgets"), deltaBudgets))
+	{
+		if (OutScenario.Baseline.IsEmpty())
+		{
+			UE_LOG(LogTemp, Error, TEXT("[PerfGate] Scenario '%s' has DeltaBudgets but no Baseline."), *InScenarioName);
+			return false;
+		}
+
+		if (!ParseMetricBudgets(**deltaBudgets, InScenarioName, OutScenario.DeltaBudgets))
+			return false;
+	}
+
+	if (OutScenario.Budgets.IsEmpty() && OutScenario.DeltaBudgets.IsEmpty())
+		UE_LOG(LogTemp, Warning, TEXT("[PerfGate] Scenario '%s' has no budget — it will always pass."), *InScenarioName);
+
+	return true;
+}
+
+bool UFSPerfGateSubsystem::ParseMetricBudgets(const FJsonObject& Budgets, const FString& InScenarioName, TMap<EFSPerfMetric, double>& OutBudgets)
+{
+	// A misspelled metric would silently disable its check
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& entry : Budgets.Values)
+	{
+		bool bKnownMetric{ false };
+		for (int32 i{ 0 }; i < static_cast<int32>(EFSPerfMetric::Count) && !bKnownMetric; ++i)
+		{
+			const EFSPerfMetric metric{ static_cast<EFSPerfMetric>(i) };
+			if (entry.Key == GetMetricName(metric))
+			{
+				OutBudgets.Add(metric, entry.Value->AsNumber());
+				bKnownMetric = true;
+			}
+		}
+
+		if (!bKnownMetric)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[PerfGate] Unknown budget '%s' in scenario '%s'."), *entry.Key, *InScenarioName);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool UFSPerfGateSubsystem::LoadBaselineReport()
+{
+	if (Scenario.Baseline.IsEmpty())
+		return true;
+
+	FString reportPath{ GetDefaultReportPath(Scenario.Baseline) };
+	FParse::Value(FCommandLine::Get(), TEXT("FSPerfGateBaseline="), reportPath);
+
+	FString reportContent;
+	TSharedPtr<FJsonObject> report;
+	const TSharedPtr<FJsonObject>* metrics{ nullptr };
+	if (!FFileHelper::LoadFileToString(reportContent, *reportPath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(reportContent), report)
+		|| !report.IsValid()
+		|| !report->TryGetObjectField(TEXT("Metrics"), metrics))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Baseline report '%s' missing or malformed — run scenario '%s' first."), *reportPath, *Scenario.Baseline);
+		return false;
+	}
+
+	for (int32 i{ 0 }; i < static_cast<int32>(EFSPerfMetric::Count); ++i)
+	{
+		const EFSPerfMetric metric{ static_cast<EFSPerfMetric>(i) };
+
+		const TSharedPtr<FJsonObject>* entry{ nullptr };
+		double measured{ 0.0 };
+		if ((*metrics)->TryGetObjectField(GetMetricName(metric), entry) && (*entry)->TryGetNumberField(TEXT("Measured"), measured))
+			BaselineMeasured.Add(metric, measured);
+	}
+
+	for (const TPair<EFSPerfMetric, double>& deltaBudget : Scenario.DeltaBudgets)
+	{
+		if (!BaselineMeasured.Contains(deltaBudget.Key))
+		{
+			UE_LOG(LogTemp, Error, TEXT("[PerfGate] Baseline report '%s' has no %s."), *reportPath, GetMetricName(deltaBudget.Key));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool UFSPerfGateSubsystem::ApplyConsoleVariables() const
+{
+	for (const TPair<FString, FString>& variable : Scenario.ConsoleVariables)
+	{
+		IConsoleVariable* consoleVariable{ IConsoleManager::Get().FindConsoleVariable(*variable.Key) };
+		if (!consoleVariable)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[PerfGate] Unknown console variable '%s' in scenario '%s'."), *variable.Key, *ScenarioName);
+			return false;
+		}
+
+		consoleVariable->Set(*variable.Value, ECVF_SetByCode);
+	}
+
+	return true;
+}
+
+void UFSPerfGateSubsystem::DriveScenario(float DeltaTime)
+{
+	if (SoakSpawned < Scenario.SoakEnemyCount)
+		SpawnSoakEnemies();
+
+	if (Scenario.bStartArena && !bArenaStarted)
+	{
+		// Arenas register once their sublevel is streamed in — keep polling until one is available
+		const UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() };
+		if (registry && !registry->GetArenas().IsEmpty())
+		{
+			AFSArenaManager* arena{ registry->GetArenas()[0] };
+			if (!arena->IsArenaActive())
+				arena->StartArena();
+
+			bArenaStarted = true;
+		}
+	}
+
+	if (Scenario.AttackScript.IsEmpty())
+		return;
+
+	if (!CombatComponent)
+	{
+		const APawn* playerPawn{ UGameplayStatics::GetPlayerPawn(GetWorld(), 0) };
+		CombatComponent = playerPawn ? playerPawn->FindComponentByClass<UFSCombatComponent>() : nullptr;
+		if (!CombatComponent)
+			return;
+	}
+
+	AttackAccumulator += DeltaTime;
+	if (AttackAccumulator < Scenario.AttackInterval)
+		return;
+
+	AttackAccumulator -= Scenario.AttackInterval;
+	CombatComponent->OnAttackInputReceived(Scenario.AttackScript[AttackScriptIndex]);
+	AttackScriptIndex = (AttackScriptIndex + 1) % Scenario.AttackScript.Num();
+}
+
+void UFSPerfGateSubsystem::SpawnSoakEnemies()
+{
+	const APawn* playerPawn{ UGameplayStatics::GetPlayerPawn(GetWorld(), 0) };
+	const UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() };
+	if (!playerPawn || !registry || registry->GetArenas().IsEmpty())
+		return;
+
+	// Enemies would kill an idle player long before the sampling ends
+	if (SoakSpawned == 0)
+		playerPawn->FindComponentByClass<UHealthComponent>()->SetInvincibility(true);
+
+	// Zone classes stream in with the arena preload — keep polling until one is resident
+	TArray<FFSSpawnCandidate> candidates;
+	registry->GetArenas()[0]->GatherSpawnCandidates(candidates);
+	if (candidates.IsEmpty())
+		return;
+
+	for (int32 i{ 0 }; i < SoakSpawnsPerFrame && SoakSpawned < Scenario.SoakEnemyCount; ++i)
+	{
+		const FFSSpawnCandidate& candidate{ candidates[SoakSpawned % candidates.Num()] };
+		if (!candidate.Zone->SpawnEnemy(candidate.EnemyClass))
+			return;
+
+		++SoakSpawned;
+	}
+
+	if (SoakSpawned == Scenario.SoakEnemyCount && FrameIndex >= Scenario.WarmupFrames)
+		UE_LOG(LogTemp, Warning, TEXT("[PerfGate] Soak population completed after the warmup — raise WarmupFrames in '%s'."), *ScenarioName);
+}
+
+// ==================== SAMPLING ====================
+
+void UFSPerfGateSubsystem::SampleFrame()
+{
+	FFlowSlayerFrameCounters& counters{ FFlowSlayerFrameCounters::Get() };
+	const uint64 mallocCalls{ GetMallocCalls() };
+
+	Samples[static_cast<int32>(EFSPerfMetric::GameThreadMs)].Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+	Samples[static_cast<int32>(EFSPerfMetric::Allocations)].Add(static_cast<float>(mallocCalls - LastMallocCalls));
+	Samples[static_cast<int32>(EFSPerfMetric::SceneQueries)].Add(static_cast<float>(counters.SceneQueries));
+	Samples[static_cast<int32>(EFSPerfMetric::TimersCreated)].Add(static_cast<float>(counters.TimersCreated));
+
+	const UFSCrowdSubsystem* crowd{ GetWorld()->GetSubsystem<UFSCrowdSubsystem>() };
+	Samples[static_cast<int32>(EFSPerfMetric::ReducedMovementEnemies)].Add(crowd ? static_cast<float>(crowd->GetReducedMovementCount()) : 0.f);
+
+	counters.Reset();
+	LastMallocCalls = mallocCalls;
+}
+
+uint64 UFSPerfGateSubsystem::GetMallocCalls()
+{
+#if STATS
+	return FMalloc::TotalMallocCalls;
+#else
+	return 0;
+#endif
+}
+
+// ==================== REPORT ====================
+
+void UFSPerfGateSubsystem::FinishScenario()
+{
+	bRunning = false;
+
+	TSharedRef<FJsonObject> report{ MakeShared<FJsonObject>() };
+	TSharedRef<FJsonObject> metrics{ MakeShared<FJsonObject>() };
+	TArray<TSharedPtr<FJsonValue>> exceeded;
+
+	for (int32 i{ 0 }; i < static_cast<int32>(EFSPerfMetric::Count); ++i)
+	{
+		const EFSPerfMetric metric{ static_cast<EFSPerfMetric>(i) };
+		const float measured{ ComputePercentile(Samples[i], BudgetPercentile) };
+
+		TSharedRef<FJsonObject> entry{ MakeShared<FJsonObject>() };
+		entry->SetNumberField(TEXT("Measured"), measured);
+		entry->SetNumberField(TEXT("Max"), ComputePercentile(Samples[i], 1.f));
+
+		if (const double* budget{ Scenario.Budgets.Find(metric) })
+		{
+			const bool bExceeded{ measured > *budget };
+			entry->SetNumberField(TEXT("Budget"), *budget);
+			entry->SetNumberField(TEXT("Delta"), measured - *budget);
+			entry->SetBoolField(TEXT("Exceeded"), bExceeded);
+			entry->SetNumberField(TEXT("SuggestedBudget"), measured * (1.0 + SuggestedBudgetHeadroom));
+
+			if (bExceeded)
+			{
+				exceeded.Add(MakeShared<FJsonValueString>(GetMetricName(metric)));
+				UE_LOG(LogTemp, Error, TEXT("[PerfGate] '%s' %s = %.2f exceeds budget %.2f."),
+					*ScenarioName, GetMetricName(metric), measured, *budget);
+			}
+		}
+
+		// A/B: delta of the two p95s, reported for every metric the baseline measured
+		if (const double* baselineMeasured{ BaselineMeasured.Find(metric) })
+		{
+			const double baselineDelta{ measured - *baselineMeasured };
+			entry->SetNumberField(TEXT("BaselineMeasured"), *baselineMeasured);
+			entry->SetNumberField(TEXT("BaselineDelta"), baselineDelta);
+
+			UE_LOG(LogTemp, Log, TEXT("[PerfGate] '%s' vs '%s' %s delta = %+.2f."),
+				*ScenarioName, *Scenario.Baseline, GetMetricName(metric), baselineDelta);
+
+			if (const double* deltaBudget{ Scenario.DeltaBudgets.Find(metric) })
+			{
+				const bool bDeltaExceeded{ baselineDelta > *deltaBudget };
+				entry->SetNumberField(TEXT("BaselineDeltaBudget"), *deltaBudget);
+				entry->SetBoolField(TEXT("BaselineDeltaExceeded"), bDeltaExceeded);
+				entry->SetNumberField(TEXT("SuggestedBaselineDeltaBudget"), baselineDelta + FMath::Abs(baselineDelta) * SuggestedBudgetHeadroom);
+
+				if (bDeltaExceeded)
+				{
+					exceeded.Add(MakeShared<FJsonValueString>(FString(GetMetricName(metric)) + TEXT("Delta")));
+					UE_LOG(LogTemp, Error, TEXT("[PerfGate] '%s' vs '%s' %s delta = %+.2f exceeds delta budget %+.2f."),
+						*ScenarioName, *Scenario.Baseline, GetMetricName(metric), baselineDelta, *deltaBudget);
+				}
+			}
+		}
+
+		metrics->SetObjectField(GetMetricName(metric), entry);
+	}
+
+	report->SetStringField(TEXT("Scenario"), ScenarioName);
+	if (!Scenario.Baseline.IsEmpty())
+		report->SetStringField(TEXT("Baseline"), Scenario.Baseline);
+	report->SetNumberField(TEXT("SampledFrames"), Samples[0].Num());
+	report->SetBoolField(TEXT("Provisional"), Scenario.bProvisional);
+	report->SetBoolField(TEXT("Passed"), exceeded.IsEmpty());
+	report->SetArrayField(TEXT("Exceeded"), exceeded);
+	report->SetObjectField(TEXT("Metrics"), metrics);
+
+	FString reportPath{ GetDefaultReportPath(ScenarioName) };
+	FParse::Value(FCommandLine::Get(), TEXT("FSPerfGateOut="), reportPath);
+
+	FString reportContent;
+	const TSharedRef<TJsonWriter<>> writer{ TJsonWriterFactory<>::Create(&reportContent) };
+	FJsonSerializer::Serialize(report, writer);
+
+	if (!FFileHelper::SaveStringToFile(reportContent, *reportPath))
+		UE_LOG(LogTemp, Error, TEXT("[PerfGate] Could not write report to '%s'."), *reportPath);
+
+	UE_LOG(LogTemp, Log, TEXT("[PerfGate] Scenario '%s' %s — report: %s"),
+		*ScenarioName, exceeded.IsEmpty() ? TEXT("passed") : TEXT("FAILED"), *reportPath);
+
+	for (const TSharedPtr<FJsonValue>& exceededBudget : exceeded)
+		ExceededBudgets.Add(exceededBudget->AsString());
+
+	// Provisional budgets were never recorded — report the overrun, keep the gate green until they are
+	if (!exceeded.IsEmpty() && Scenario.bProvisional)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[PerfGate] Scenario '%s' budgets are provisional — not failing. Record them from the report's SuggestedBudget values."),
+			*ScenarioName);
+		RequestExit(0);
+		return;
+	}
+
+	RequestExit(exceeded.IsEmpty() ? 0 : ExitCodeBudgetExceeded);
+}
+
+void UFSPerfGateSubsystem::RequestExit(uint8 ReturnCode)
+{
+	bRunning = false;
+	bFinished = true;
+	ResultCode = ReturnCode;
+
+	if (AutomationScenarioName.IsEmpty())
+		FPlatformMisc::RequestExitWithStatus(false, ReturnCode);
+}
+
+FString UFSPerfGateSubsystem::GetDefaultReportPath(const FString& InScenarioName)
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PerfGate"), InScenarioName + TEXT(".json"));
+}
+
+float UFSPerfGateSubsystem::ComputePercentile(TArray<float> Values, float Percentile)
+{
+	if (Values.IsEmpty())
+		return 0.f;
+
+	Values.Sort();
+	const int32 index{ FMath::Clamp(FMath::CeilToInt(Percentile * Values.Num()) - 1, 0, Values.Num() - 1) };
+	return Values[index];
+}
+
+const TCHAR* UFSPerfGateSubsystem::GetMetricName(EFSPerfMetric Metric)
+{
+	switch (Metric)
+	{
+	case EFSPerfMetric::GameThreadMs:           return TEXT("GameThreadMsP95");
+	case EFSPerfMetric::Allocations:            return TEXT("AllocationsPerFrameP95");
+	case EFSPerfMetric::SceneQueries:           return TEXT("SceneQueriesPerFrameP95");
+	case EFSPerfMetric::TimersCreated:          return TEXT("TimersCreatedPerFrameP95");
+	case EFSPerfMetric::ReducedMovementEnemies: return TEXT("ReducedMovementEnemiesP95");
+	default:                                    return TEXT("Unknown");
+	}
+}
@@ -1,4 +1,5 @@
 #include "FSProjectile.h"
+#include "FlowSlayerStats.h"
 
 AFSProjectile::AFSProjectile()
 {
@@ -41,8 +42,21 @@ void AFSProjectile::BeginPlay()
     if (Owner)
         CollisionComponent->IgnoreActorWhenMoving(Owner, true);
 
-    if (trailParticules && TrailComponent)
-        TrailComponent->SetAsset(trailParticules);
+    UNiagaraSystem* trailSystem{ trailParticules.Get() };
+    if (trailSystem && TrailComponent)
+        TrailComponent->SetAsset(trailSystem);
+}
+
+void AFSProjectile::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+    if (!trailParticules.IsNull())
+        OutAssets.AddUnique(trailParticules.ToSoftObjectPath());
+
+    for (const TSoftObjectPtr<UNiagaraSystem>& system : hitParticlesSystemArray)
+    {
+        if (!system.IsNull())
+            OutAssets.AddUnique(system.ToSoftObjectPath());
+    }
 }
 
 void AFSProjectile::FireInDirection(const FVector& ShootDirection)
@@ -59,7 +73,10 @@ AFSProjectile* AFSProjectile::SpawnProjectile(UWorld* world, AActor* owner, AAct
     FActorSpawnParameters SpawnParams;
     SpawnParams.Owner = owner;
     SpawnParams.Instigator = owner->GetInstigator();
+    SpawnParams.OverrideLevel = owner->GetLevel();
 
+    FS_INC_COUNTER(Spawns);
+    LLM_SCOPE_BYTAG(FlowSlayer_Projectiles);
     AFSProjectile* projectile{ world->SpawnActor<AFSProjectile>(
         projectileClass,
         spawnLocation,
@@ -110,9 +127,10 @@ void AFSProjectile::SpawnHitVFX(const FVector& location)
     if (!hitParticlesSystemArray.IsValidIndex(randIndex))
         return;
 
-    UNiagaraSystem* hitParticulesSystem{ hitParticlesSystemArray[randIndex] };
+    UNiagaraSystem* hitParticulesSystem{ hitParticlesSystemArray[randIndex].Get() };
     if (hitParticulesSystem)
     {
+        LLM_SCOPE_BYTAG(FlowSlayer_VFX);
         UNiagaraFunctionLibrary::SpawnSystemAtLocation(
             GetWorld(),
             hitParticulesSystem,
@@ -0,0 +1,112 @@
+#include "FSSpawnDirector.h"
+#include "FlowSlayerStats.h"
+#include "FSEnemyArchetype.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+TRACE_DECLARE_FLOAT_COUNTER(FSSpawnFrameCost, TEXT("FlowSlayer/Spawn/FrameCostMs"));
+TRACE_DECLARE_INT_COUNTER(FSSpawnDifficulty, TEXT("FlowSlayer/Spawn/Difficulty"));
+TRACE_DECLARE_INT_COUNTER(FSSpawnDifficultyTarget, TEXT("FlowSlayer/Spawn/DifficultyTarget"));
+
+void FFSSpawnDirector::Reset(int32 InDifficultyTarget)
+{
+	State = FFSSpawnBudgetState{};
+	State.FrameBudgetMs = FrameBudgetMs;
+	State.DifficultyTarget = InDifficultyTarget;
+	PublishState();
+}
+
+void FFSSpawnDirector::SetDifficultyTarget(int32 InDifficultyTarget)
+{
+	State.DifficultyTarget = InDifficultyTarget;
+	PublishState();
+}
+
+const FFSSpawnCandidate* FFSSpawnDirector::PickCandidate(TConstArrayView<FFSSpawnCandidate> Candidates)
+{
+	MeasureGameThread();
+
+	if (Candidates.IsEmpty())
+		return nullptr;
+
+	if (State.Difficulty >= State.DifficultyTarget)
+	{
+		++State.TargetDeferrals;
+		return nullptr;
+	}
+
+	if (GameThreadBudgetMs > 0.f && State.MeasuredGameThreadMs > GameThreadBudgetMs)
+	{
+		++State.PerfDeferrals;
+		return nullptr;
+	}
+
+	const int32 difficultyGap{ State.DifficultyTarget - State.Difficulty };
+
+	TArray<const FFSSpawnCandidate*, TInlineAllocator<16>> fitting;
+	const FFSSpawnCandidate* cheapest{ nullptr };
+	for (const FFSSpawnCandidate& candidate : Candidates)
+	{
+		if (State.FrameCostMs + GetFrameCostMs(*candidate.Archetype) > FrameBudgetMs)
+			continue;
+
+		if (candidate.Archetype->DifficultyCost <= difficultyGap)
+			fitting.Add(&candidate);
+
+		if (!cheapest || candidate.Archetype->DifficultyCost < cheapest->Archetype->DifficultyCost)
+			cheapest = &candidate;
+	}
+
+	if (!fitting.IsEmpty())
+		return fitting[FMath::RandRange(0, fitting.Num() - 1)];
+
+	// The target is not a cap — overshoot by one spawn rather than leave the arena under-populated
+	if (cheapest)
+		return cheapest;
+
+	++State.PerfDeferrals;
+	return nullptr;
+}
+
+void FFSSpawnDirector::NotifySpawned(const UFSEnemyArchetype& Archetype)
+{
+	State.FrameCostMs += GetFrameCostMs(Archetype);
+	State.Difficulty += Archetype.DifficultyCost;
+	PublishState();
+}
+
+void FFSSpawnDirector::NotifyDespawned(const UFSEnemyArchetype& Archetype)
+{
+	State.FrameCostMs = FMath::Max(0.f, State.FrameCostMs - GetFrameCostMs(Archetype));
+	State.Difficulty = FMath::Max(0, State.Difficulty - Archetype.DifficultyCost);
+	PublishState();
+}
+
+float FFSSpawnDirector::GetNextSpawnDelay(float MinDelay, float MaxDelay) const
+{
+	const float fillRatio{ static_cast<float>(State.Difficulty) / static_cast<float>(FMath::Max(State.DifficultyTarget, 1)) };
+	return FMath::Lerp(MinDelay, MaxDelay, FMath::Clamp(fillRatio, 0.f, 1.f));
+}
+
+float FFSSpawnDirector::GetFrameCostMs(const UFSEnemyArchetype& Archetype) const
+{
+	return Archetype.CpuCostMs + Archetype.AnimationCostMs + Archetype.ProjectilesPerSecond * ProjectileCostMs;
+}
+
+void FFSSpawnDirector::MeasureGameThread()
+{
+	const float gameThreadMs{ static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime)) };
+	State.MeasuredGameThreadMs = State.MeasuredGameThreadMs > 0.f
+		? FMath::Lerp(State.MeasuredGameThreadMs, gameThreadMs, gameThreadSmoothing)
+		: gameThreadMs;
+}
+
+void FFSSpawnDirector::PublishState() const
+{
+	SET_FLOAT_STAT(STAT_FS_SpawnFrameCostMs, State.FrameCostMs);
+	SET_DWORD_STAT(STAT_FS_SpawnDifficulty, State.Difficulty);
+	SET_DWORD_STAT(STAT_FS_SpawnDifficultyTarget, State.DifficultyTarget);
+
+	TRACE_COUNTER_SET(FSSpawnFrameCost, State.FrameCostMs);
+	TRACE_COUNTER_SET(FSSpawnDifficulty, State.Difficulty);
+	TRACE_COUNTER_SET(FSSpawnDifficultyTarget, State.DifficultyTarget);
+}
@@ -0,0 +1,83 @@
+#include "FSStatsComponent.h"
+
+const FStatAggregate FStatAggregate::Identity{};
+
+UFSStatsComponent::UFSStatsComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UFSStatsComponent::SetModifier(EUpgradeStat Stat, FName Source, EUpgradeValueType ValueType, float Value)
+{
+	if (Stat == EUpgradeStat::None || Stat >= EUpgradeStat::Count)
+		return;
+
+	int32 statIndex{ static_cast<int32>(Stat) };
+	TArray<FStatModifier>& stack{ Modifiers[statIndex] };
+
+	FStatModifier* modifier{ stack.FindByPredicate([Source](const FStatModifier& entry) { return entry.Source == Source; }) };
+	if (!modifier)
+	{
+		modifier = &stack.AddDefaulted_GetRef();
+		modifier->Source = Source;
+	}
+
+	modifier->ValueType = ValueType;
+	modifier->Value = Value;
+
+	DirtyStats |= 1u << statIndex;
+	RecomputeDirtyStats();
+}
+
+void UFSStatsComponent::RemoveModifier(EUpgradeStat Stat, FName Source)
+{
+	if (Stat == EUpgradeStat::None || Stat >= EUpgradeStat::Count)
+		return;
+
+	int32 statIndex{ static_cast<int32>(Stat) };
+	if (Modifiers[statIndex].RemoveAll([Source](const FStatModifier& entry) { return entry.Source == Source; }) == 0)
+		return;
+
+	DirtyStats |= 1u << statIndex;
+	RecomputeDirtyStats();
+}
+
+const FStatAggregate* UFSStatsComponent::GetAggregate(EUpgradeStat Stat) const
+{
+	if (Stat == EUpgradeStat::None || Stat >= EUpgradeStat::Count)
+		return &FStatAggregate::Identity;
+
+	return &Aggregates[static_cast<int32>(Stat)];
+}
+
+const FStatAggregate* UFSStatsComponent::FindAggregate(const AActor* Actor, EUpgradeStat Stat)
+{
+	const UFSStatsComponent* stats{ Actor ? Actor->FindComponentByClass<UFSStatsComponent>() : nullptr };
+	return stats ? stats->GetAggregate(Stat) : &FStatAggregate::Identity;
+}
+
+void UFSStatsComponent::RecomputeDirtyStats()
+{
+	while (DirtyStats != 0)
+	{
+		int32 statIndex{ static_cast<int32>(FMath::CountTrailingZeros(DirtyStats)) };
+		DirtyStats &= DirtyStats - 1;
+
+		// Rebuilt from the stack — never patched incrementally, so replacing a tier leaves no residue
+		FStatAggregate aggregate;
+		for (const FStatModifier& modifier : Modifiers[statIndex])
+		{
+			if (modifier.ValueType == EUpgradeValueType::Additive)
+				aggregate.Additive += modifier.Value;
+			else
+				aggregate.Multiplier *= modifier.Value;
+		}
+
+		Aggregates[statIndex] = aggregate;
+
+		UE_LOG(LogTemp, Verbose, TEXT("[StatsComponent] %s → +%.3f x%.3f (%d modifiers)"),
+			*StaticEnum<EUpgradeStat>()->GetNameStringByIndex(statIndex), aggregate.Additive, aggregate.Multiplier, Modifiers[statIndex].Num());
+
+		OnStatChanged.Broadcast(static_cast<EUpgradeStat>(statIndex));
+	}
+}
@@ -1,4 +1,6 @@
 #include "FSWeapon.h"
+#include "FlowSlayerStats.h"
+#include "NiagaraSystem.h"
 
 AFSWeapon::AFSWeapon()
 {
@@ -6,17 +8,39 @@ AFSWeapon::AFSWeapon()
     InitializeComponents();
 }
 
+void AFSWeapon::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Spawned by CombatComponent with the character as Owner
+    OwnerStats = GetOwner() ? GetOwner()->FindComponentByClass<UFSStatsComponent>() : nullptr;
+    if (!OwnerStats)
+        UE_LOG(LogTemp, Warning, TEXT("[FSWeapon] Owner has no UFSStatsComponent — weapon parts will have no stat effect."));
+
+    RefreshTrailSystem();
+}
+
 void AFSWeapon::EquipPart(EWeaponPartType PartType, const FWeaponPartData& PartData)
 {
-    // Undo the previous tier's stat contribution before applying the new tier
-    if (FWeaponPartData* previous{ EquippedPartDataCache.Find(PartType) })
-        ApplyPartStat(BuildReversePart(*previous));
+    FName source{ GetPartModifierSource(PartType) };
+
+    if (OwnerStats)
+    {
+        // Same stat → SetModifier replaces the previous tier; different stat → drop it explicitly
+        const FWeaponPartData* previous{ EquippedPartDataCache.Find(PartType) };
+        if (previous && previous->Stat != PartData.Stat)
+            OwnerStats->RemoveModifier(previous->Stat, source);
+
+        OwnerStats->SetModifier(PartData.Stat, source, PartData.ValueType, PartData.Value);
+    }
 
-    ApplyPartStat(PartData);
     EquippedPartTiers.Add(PartType, PartData.Tier);
     EquippedPartDataCache.Add(PartType, PartData);
 
-    UE_LOG(LogTemp, Log, TEXT("[FSWeapon] Equipped part '%s' T%d — DamageMultiplier: %.3f"), *PartData.PartID.ToString(), PartData.Tier, WeaponDamageMultiplier);
+    if (PartType == EWeaponPartType::Blade)
+        RefreshTrailSystem();
+
+    UE_LOG(LogTemp, Log, TEXT("[FSWeapon] Equipped part '%s' T%d"), *PartData.PartID.ToString(), PartData.Tier);
 }
 
 int32 AFSWeapon::GetCurrentTier(EWeaponPartType PartType) const
@@ -25,34 +49,93 @@ int32 AFSWeapon::GetCurrentTier(EWeaponPartType PartType) const
     return tier ? *tier : 0;
 }
 
-void AFSWeapon::ApplyPartStat(const FWeaponPartData& PartData)
+void AFSWeapon::BindTrailSystem(UNiagaraSystem* TrailSystem)
 {
-    switch (PartData.Stat)
+    if (!TrailSystem || TrailSystem == BoundTrailSystem)
+        return;
+
+    LLM_SCOPE_BYTAG(FlowSlayer_VFX);
+
+    bTrailEmitGated = TrailSystem->GetExposedParameters().IndexOf(FNiagaraVariable(FNiagaraTypeDefinition::GetBoolDef(), TrailEmitParameter)) != INDEX_NONE;
+    if (!bTrailEmitGated)
+        UE_LOG(LogTemp, Warning, TEXT("[FSWeapon] Trail system '%s' has no bool '%s' — restarted on every swing instead."), *TrailSystem->GetName(), *TrailEmitParameter.ToString());
+
+    for (UNiagaraComponent* trailComponent : { TrailNiagaraBaseComponent, TrailNiagaraTipComponent })
     {
-    case EUpgradeStat::Damage:
-        if (PartData.ValueType == EUpgradeValueType::Additive)
-            WeaponDamageMultiplier += PartData.Value;
-        else
-            WeaponDamageMultiplier *= PartData.Value;
-        WeaponDamageMultiplier = FMath::Max(0.f, WeaponDamageMultiplier);
-        break;
+        if (!trailComponent)
+            continue;
+
+        trailComponent->SetAsset(TrailSystem);
 
-    default:
-        // Extension point — add Handle / Gem stat cases here when their stats are defined
-        break;
+        // Gated systems are initialized once here and stay active, emitting nothing until a swing opens the gate
+        if (bTrailEmitGated)
+        {
+            trailComponent->SetVariableBool(TrailEmitParameter, false);
+            trailComponent->Activate(true);
+        }
     }
+
+    BoundTrailSystem = TrailSystem;
 }
 
-FWeaponPartData AFSWeapon::BuildReversePart(const FWeaponPartData& PartData) const
+void AFSWeapon::SetTrailActive(bool bActive, UNiagaraSystem* NotifyTrailSystem)
 {
-    FWeaponPartData reverse{ PartData };
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_WeaponSetTrailActive);
 
-    if (reverse.ValueType == EUpgradeValueType::Additive)
-        reverse.Value = -reverse.Value;
-    else
-        reverse.Value = (reverse.Value != 0.f) ? (1.f / reverse.Value) : 1.f;
+    if (bActive)
+    {
+        BindTrailSystem(TierTrailSystem ? TierTrailSystem : NotifyTrailSystem);
+        ++TrailRibbonID;
+    }
+
+    if (!BoundTrailSystem)
+        return;
+
+    for (UNiagaraComponent* trailComponent : { TrailNiagaraBaseComponent, TrailNiagaraTipComponent })
+    {
+        if (!trailComponent)
+            continue;
+
+        if (bTrailEmitGated)
+        {
+            // A new ribbon ID keeps the first particle of this swing from linking to the previous swing's last
+            if (bActive)
+            {
+                trailComponent->SetVariableInt(TrailRibbonIDParameter, TrailRibbonID);
+                if (!trailComponent->IsActive())
+                    trailComponent->Activate();
+            }
+
+            trailComponent->SetVariableBool(TrailEmitParameter, bActive);
+        }
+        // Reset starts a fresh ribbon — a resumed one would link its first particle to the previous swing's last
+        else if (bActive)
+            trailComponent->Activate(true);
+        else
+            trailComponent->Deactivate();
+    }
+}
+
+void AFSWeapon::RefreshTrailSystem()
+{
+    TierTrailSystem = nullptr;
+
+    // Highest authored system at or below the equipped blade tier
+    for (int32 tier{ FMath::Min(GetCurrentTier(EWeaponPartType::Blade), TrailSystemsByBladeTier.Num() - 1) }; tier >= 0; --tier)
+    {
+        if (UNiagaraSystem* trailSystem{ TrailSystemsByBladeTier[tier] })
+        {
+            TierTrailSystem = trailSystem;
+            BindTrailSystem(trailSystem);
+            return;
+        }
+    }
+}
 
-    return reverse;
+FName AFSWeapon::GetPartModifierSource(EWeaponPartType PartType)
+{
+    static const FName sources[]{ TEXT("WeaponPart.Blade"), TEXT("WeaponPart.Handle"), TEXT("WeaponPart.Gem") };
+    return sources[static_cast<int32>(PartType)];
 }
 
 void AFSWeapon::InitializeComponents()
@@ -0,0 +1,125 @@
+#include "FSWorldMarkerOverlay.h"
+#include "FlowSlayerStats.h"
+#include "FSWorldMarkerSubsystem.h"
+#include "FSWorldMarkerWidget.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Blueprint/WidgetLayoutLibrary.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "SceneView.h"
+
+void UFSWorldMarkerOverlay::NativeConstruct()
+{
+	Super::NativeConstruct();
+
+	MarkerSubsystem = GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>();
+	checkf(MarkerSubsystem, TEXT("FATAL: [WorldMarkerOverlay] WorldMarkerSubsystem not found."));
+
+	if (!MarkerCanvas || !MarkerClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[WorldMarkerOverlay] MarkerCanvas or MarkerClass is not set — no world marker will be drawn."));
+		return;
+	}
+
+	MarkerPool.Reserve(InitialPoolSize);
+	for (int32 i{ 0 }; i < InitialPoolSize; ++i)
+		MarkerPool.Add(CreateMarker());
+}
+
+void UFSWorldMarkerOverlay::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	Super::NativeTick(MyGeometry, InDeltaTime);
+
+	if (MarkerCanvas && MarkerClass)
+		UpdateMarkers();
+}
+
+bool UFSWorldMarkerOverlay::CacheViewProjection()
+{
+	const APlayerController* playerController{ GetOwningPlayer() };
+	const ULocalPlayer* localPlayer{ playerController ? playerController->GetLocalPlayer() : nullptr };
+	if (!localPlayer || !localPlayer->ViewportClient)
+		return false;
+
+	FSceneViewProjectionData projectionData;
+	if (!localPlayer->GetProjectionData(localPlayer->ViewportClient->Viewport, projectionData))
+		return false;
+
+	ViewProjectionMatrix = projectionData.ComputeViewProjectionMatrix();
+	ViewRect = projectionData.GetConstrainedViewRect();
+	return true;
+}
+
+void UFSWorldMarkerOverlay::UpdateMarkers()
+{
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_WorldMarkerUpdate);
+
+	const TArray<FFSWorldMarker>& markers{ MarkerSubsystem->GetMarkers() };
+	if (markers.IsEmpty() && ShownCount == 0)
+		return;
+
+	int32 usedCount{ 0 };
+	if (!markers.IsEmpty() && CacheViewProjection())
+	{
+		// Projection returns viewport pixels, the canvas is laid out in DPI-scaled slate units
+		const float viewportScale{ FMath::Max(UWidgetLayoutLibrary::GetViewportScale(this), UE_KINDA_SMALL_NUMBER) };
+		const FVector2D viewOrigin{ ViewRect.Min };
+		const FBox2D cullBounds{ FVector2D(ViewRect.Min) - CullMargin, FVector2D(ViewRect.Max) + CullMargin };
+
+		for (const FFSWorldMarker& marker : markers)
+		{
+			const AActor* target{ marker.Target.Get() };
+			if (!target)
+				continue;
+
+			FVector2D screenPosition;
+			const FVector anchor{ target->GetActorLocation() + FVector(0.f, 0.f, marker.AnchorHeight) };
+			if (!FSceneView::ProjectWorldToScreen(anchor, ViewRect, ViewProjectionMatrix, screenPosition) || !cullBounds.IsInside(screenPosition))
+				continue;
+
+			UFSWorldMarkerWidget* markerWidget{ AcquireMarker(usedCount++) };
+			markerWidget->SetMarkerState(marker);
+			markerWidget->SetRenderTranslation((screenPosition - viewOrigin) / viewportScale);
+		}
+	}
+
+	// Markers used last frame but not this one go back to the pool
+	for (int32 i{ usedCount }; i < ShownCount; ++i)
+	{
+		MarkerPool[i]->ResetMarkerState();
+		MarkerPool[i]->SetVisibility(ESlateVisibility::Collapsed);
+	}
+
+	ShownCount = usedCount;
+}
+
+UFSWorldMarkerWidget* UFSWorldMarkerOverlay::AcquireMarker(int32 PoolIndex)
+{
+	while (!MarkerPool.IsValidIndex(PoolIndex))
+		MarkerPool.Add(CreateMarker());
+
+	UFSWorldMarkerWidget* markerWidget{ MarkerPool[PoolIndex] };
+	if (PoolIndex >= ShownCount)
+		markerWidget->SetVisibility(ESlateVisibility::HitTestInvisible);
+
+	return markerWidget;
+}
+
+UFSWorldMarkerWidget* UFSWorldMarkerOverlay::CreateMarker()
+{
+	LLM_SCOPE_BYTAG(FlowSlayer_UI);
+
+	UFSWorldMarkerWidget* markerWidget{ CreateWidget<UFSWorldMarkerWidget>(GetOwningPlayer(), MarkerClass) };
+	checkf(markerWidget, TEXT("FATAL: [WorldMarkerOverlay] Could not create a marker widget."));
+
+	markerWidget->SetVisibility(ESlateVisibility::Collapsed);
+
+	// The slot stays at the canvas origin for the marker's whole life — only its render translation moves
+	UCanvasPanelSlot* canvasSlot{ MarkerCanvas->AddChildToCanvas(markerWidget) };
+	canvasSlot->SetAutoSize(true);
+	canvasSlot->SetPosition(FVector2D::ZeroVector);
+	canvasSlot->SetAlignment(FVector2D(0.5f, 1.f));
+
+	return markerWidget;
+}
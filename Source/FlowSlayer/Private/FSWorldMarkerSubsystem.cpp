@@ -0,0 +1,85 @@
+#include "FSWorldMarkerSubsystem.h"
+#include "HealthComponent.h"
+#include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
+
+void UFSWorldMarkerSubsystem::SetHealthBarVisible(AActor* Target, bool bVisible)
+{
+	SetMarkerFlag(Target, &FFSWorldMarker::bHealthBarVisible, bVisible);
+}
+
+void UFSWorldMarkerSubsystem::SetLockOnMarkerVisible(AActor* Target, bool bVisible)
+{
+	SetMarkerFlag(Target, &FFSWorldMarker::bLockOnVisible, bVisible);
+}
+
+void UFSWorldMarkerSubsystem::SetInteractPromptVisible(AActor* Target, bool bVisible)
+{
+	SetMarkerFlag(Target, &FFSWorldMarker::bInteractPromptVisible, bVisible);
+}
+
+void UFSWorldMarkerSubsystem::SetMarkerFlag(AActor* Target, bool FFSWorldMarker::* Flag, bool bVisible)
+{
+	if (!Target)
+		return;
+
+	if (bVisible)
+	{
+		FindOrAddMarker(Target).*Flag = true;
+		return;
+	}
+
+	if (const int32* markerIndex{ MarkerIndexByTarget.Find(Target) })
+	{
+		Markers[*markerIndex].*Flag = false;
+		RemoveIfHidden(*markerIndex);
+	}
+}
+
+void UFSWorldMarkerSubsystem::RemoveTarget(AActor* Target)
+{
+	if (const int32* markerIndex{ MarkerIndexByTarget.Find(Target) })
+		RemoveAt(*markerIndex);
+}
+
+FFSWorldMarker& UFSWorldMarkerSubsystem::FindOrAddMarker(AActor* Target)
+{
+	if (const int32* markerIndex{ MarkerIndexByTarget.Find(Target) })
+		return Markers[*markerIndex];
+
+	FFSWorldMarker& marker{ Markers.AddDefaulted_GetRef() };
+	marker.Target = Target;
+	marker.TargetKey = Target;
+	marker.Health = Target->FindComponentByClass<UHealthComponent>();
+
+	marker.AnchorHeight = ComputeAnchorHeight(Target);
+
+	MarkerIndexByTarget.Add(Target, Markers.Num() - 1);
+	return marker;
+}
+
+void UFSWorldMarkerSubsystem::RemoveIfHidden(int32 MarkerIndex)
+{
+	if (!Markers[MarkerIndex].IsAnyVisible())
+		RemoveAt(MarkerIndex);
+}
+
+void UFSWorldMarkerSubsystem::RemoveAt(int32 MarkerIndex)
+{
+	MarkerIndexByTarget.Remove(Markers[MarkerIndex].TargetKey);
+	Markers.RemoveAtSwap(MarkerIndex, 1, EAllowShrinking::No);
+
+	if (Markers.IsValidIndex(MarkerIndex))
+		MarkerIndexByTarget.Add(Markers[MarkerIndex].TargetKey, MarkerIndex);
+}
+
+float UFSWorldMarkerSubsystem::ComputeAnchorHeight(const AActor* Target)
+{
+	if (const ACharacter* character{ Cast<ACharacter>(Target) })
+		return character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight() + AnchorPadding;
+
+	FVector origin;
+	FVector extent;
+	Target->GetActorBounds(false, origin, extent);
+	return (origin.Z + extent.Z - Target->GetActorLocation().Z) + AnchorPadding;
+}
@@ -0,0 +1,49 @@
+#include "FSWorldMarkerWidget.h"
+#include "FSWorldMarkerSubsystem.h"
+#include "HealthComponent.h"
+#include "Components/ProgressBar.h"
+
+void UFSWorldMarkerWidget::SetMarkerState(const FFSWorldMarker& Marker)
+{
+	SetOwningActor(Marker.Target.Get());
+
+	const UHealthComponent* health{ Marker.Health.Get() };
+	const bool bShowHealthBar{ Marker.bHealthBarVisible && health };
+
+	SetPartVisible(HealthBar, bHealthBarShown, bShowHealthBar);
+	SetPartVisible(LockOnIcon, bLockOnShown, Marker.bLockOnVisible);
+	SetPartVisible(InteractPrompt, bInteractPromptShown, Marker.bInteractPromptVisible);
+
+	if (HealthBar && bShowHealthBar)
+	{
+		const float healthRatio{ health->GetHealthRatio() };
+		if (!FMath::IsNearlyEqual(LastHealthRatio, healthRatio))
+		{
+			LastHealthRatio = healthRatio;
+			HealthBar->SetPercent(healthRatio);
+		}
+	}
+}
+
+void UFSWorldMarkerWidget::ResetMarkerState()
+{
+	SetOwningActor(nullptr);
+}
+
+void UFSWorldMarkerWidget::SetPartVisible(UWidget* Part, bool& bShown, bool bVisible)
+{
+	if (!Part || bShown == bVisible)
+		return;
+
+	bShown = bVisible;
+	Part->SetVisibility(bVisible ? ESlateVisibility::HitTestInvisible : ESlateVisibility::Collapsed);
+}
+
+void UFSWorldMarkerWidget::SetOwningActor(AActor* NewOwningActor)
+{
+	if (OwningActor == NewOwningActor)
+		return;
+
+	OwningActor = NewOwningActor;
+	OnOwningActorChanged(NewOwningActor);
+}
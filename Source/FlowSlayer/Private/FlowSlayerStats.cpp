@@ -0,0 +1,45 @@
+#include "FlowSlayerStats.h"
+
+UE_TRACE_CHANNEL_DEFINE(FlowSlayerChannel);
+
+LLM_DEFINE_TAG(FlowSlayer);
+LLM_DEFINE_TAG(FlowSlayer_Enemies);
+LLM_DEFINE_TAG(FlowSlayer_Projectiles);
+LLM_DEFINE_TAG(FlowSlayer_CombatData);
+LLM_DEFINE_TAG(FlowSlayer_UI);
+LLM_DEFINE_TAG(FlowSlayer_VFX);
+
+DEFINE_STAT(STAT_FS_HitboxActiveFrameStarted);
+DEFINE_STAT(STAT_FS_HitboxProcessHits);
+DEFINE_STAT(STAT_FS_CombatHandleOnHitLanded);
+DEFINE_STAT(STAT_FS_EnemyHandleOnHitLanded);
+DEFINE_STAT(STAT_FS_LockOnEngage);
+DEFINE_STAT(STAT_FS_ArenaTrySpawnEnemy);
+DEFINE_STAT(STAT_FS_AIFollowPlayer);
+DEFINE_STAT(STAT_FS_HitFeedbackOnLandHit);
+DEFINE_STAT(STAT_FS_ProgressionDrawMixedRewards);
+DEFINE_STAT(STAT_FS_WorldMarkerUpdate);
+DEFINE_STAT(STAT_FS_HUDFlush);
+DEFINE_STAT(STAT_FS_EnemyUpdate);
+DEFINE_STAT(STAT_FS_EnemyUpdateCompute);
+DEFINE_STAT(STAT_FS_EnemyUpdateApply);
+DEFINE_STAT(STAT_FS_WeaponSetTrailActive);
+DEFINE_STAT(STAT_FS_DashMove);
+
+DEFINE_STAT(STAT_FS_SceneQueries);
+DEFINE_STAT(STAT_FS_AsyncSceneQueries);
+DEFINE_STAT(STAT_FS_HitsProcessed);
+DEFINE_STAT(STAT_FS_TimersCreated);
+DEFINE_STAT(STAT_FS_Spawns);
+DEFINE_STAT(STAT_FS_DelegateBroadcasts);
+
+DEFINE_STAT(STAT_FS_SpawnFrameCostMs);
+DEFINE_STAT(STAT_FS_SpawnDifficulty);
+DEFINE_STAT(STAT_FS_SpawnDifficultyTarget);
+DEFINE_STAT(STAT_FS_ReducedMovementEnemies);
+
+FFlowSlayerFrameCounters& FFlowSlayerFrameCounters::Get()
+{
+	static FFlowSlayerFrameCounters counters;
+	return counters;
+}
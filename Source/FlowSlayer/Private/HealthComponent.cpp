@@ -1,36 +1,43 @@
 #include "HealthComponent.h"
+#include "FlowSlayerStats.h"
+#include "FSWorldMarkerSubsystem.h"
 
 UHealthComponent::UHealthComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
-
-    LifeBarWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("LifeBarWidget"));
-    LifeBarWidget->SetWidgetSpace(EWidgetSpace::Screen);
-    LifeBarWidget->SetDrawSize(FVector2D(100.f, 15.f));
-    LifeBarWidget->SetVisibility(false);
 }
 
 void UHealthComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	CurrentHealth = MaxHealth;
-
-    // Register and attach life bar to the owner's mesh
-    // WidgetComponent created inside an UActorComponent constructor is not auto-registered
-    // as an actor component — it has no World reference and InitWidget() is never called.
-    // We must register it explicitly so GetUserWidgetObject() returns a valid widget.
-    ACharacter* ownerCharacter{ Cast<ACharacter>(GetOwner()) };
-    if (ownerCharacter)
+    if (UFSStatsComponent* stats{ GetOwner()->FindComponentByClass<UFSStatsComponent>() })
     {
-        if (!LifeBarWidget->IsRegistered())
-            LifeBarWidget->RegisterComponent();
-
-        LifeBarWidget->AttachToComponent(ownerCharacter->GetMesh(), FAttachmentTransformRules::KeepRelativeTransform);
-        LifeBarWidget->InitWidget();
+        MaxHealthStat = stats->GetAggregate(EUpgradeStat::MaxHealth);
+        HealCooldownStat = stats->GetAggregate(EUpgradeStat::HealCooldown);
+        HealFlowCostStat = stats->GetAggregate(EUpgradeStat::HealFlowCost);
+        stats->OnStatChanged.AddUObject(this, &UHealthComponent::HandleOnStatChanged);
     }
 
-    InitializeLifeBarWidgetRef();
+	CurrentMaxHealth = FMath::Max(1.f, MaxHealthStat->Apply(MaxHealth));
+	CurrentHealth = CurrentMaxHealth;
+}
+
+void UHealthComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+        markers->RemoveTarget(GetOwner());
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UHealthComponent::DisplayLifeBar(bool bDisplay)
+{
+    if (!bShowWorldHealthBar)
+        return;
+
+    if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+        markers->SetHealthBarVisible(GetOwner(), bDisplay);
 }
 
 void UHealthComponent::ReceiveDamage(float damageAmount, AActor* instigator)
@@ -40,14 +47,15 @@ void UHealthComponent::ReceiveDamage(float damageAmount, AActor* instigator)
 
     CurrentHealth -= damageAmount;
 
-    LifeBarWidget->SetVisibility(true);
+    DisplayLifeBar(true);
 
-    OnDamageReceived.Broadcast(instigator, damageAmount, CurrentHealth, MaxHealth);
+    FS_INC_COUNTER(DelegateBroadcasts);
+    OnDamageReceived.Broadcast(instigator, damageAmount, CurrentHealth, CurrentMaxHealth);
 
     if (CurrentHealth <= 0.f)
     {
         OnDeath.ExecuteIfBound();
-        LifeBarWidget->SetVisibility(false);
+        DisplayLifeBar(false);
     }
 }
 
@@ -56,67 +64,28 @@ void UHealthComponent::Heal()
     if (bIsHealOnCooldown)
         return;
 
-    CurrentHealth = MaxHealth;
+    CurrentHealth = CurrentMaxHealth;
     bIsHealOnCooldown = true;
 
+    FS_INC_COUNTER(TimersCreated);
     GetWorld()->GetTimerManager().SetTimer(
         HealCooldownTimer,
         [this]() { bIsHealOnCooldown = false; },
-        HealCooldown,
+        FMath::Max(0.f, HealCooldownStat->Apply(HealCooldown)),
         false
     );
 
     OnHeal.Broadcast();
 }
 
-void UHealthComponent::HandleOnUpgradeSelected(const FUpgradeData& Upgrade)
+void UHealthComponent::HandleOnStatChanged(EUpgradeStat Stat)
 {
-    auto ApplyValue = [&Upgrade](float& Stat)
-    {
-        if (Upgrade.ValueType == EUpgradeValueType::Additive)
-            Stat += Upgrade.Value;
-        else
-            Stat *= Upgrade.Value;
-    };
-
-    switch (Upgrade.Stat)
-    {
-    case EUpgradeStat::MaxHealth:
-    {
-        float oldMax{ MaxHealth };
-        ApplyValue(MaxHealth);
-        MaxHealth = FMath::Max(1.f, MaxHealth);
-        // Heal the gained HP so the upgrade feels rewarding
-        CurrentHealth = FMath::Clamp(CurrentHealth + (MaxHealth - oldMax), 0.f, MaxHealth);
-        break;
-    }
-    case EUpgradeStat::HealCooldown:
-        ApplyValue(HealCooldown);
-        HealCooldown = FMath::Max(0.f, HealCooldown);
-        break;
-    case EUpgradeStat::HealFlowCost:
-        ApplyValue(HealFlowCost);
-        HealFlowCost = FMath::Max(0.f, HealFlowCost);
-        break;
-    default:
-        break;
-    }
-}
-
-void UHealthComponent::InitializeLifeBarWidgetRef()
-{
-    if (!LifeBarWidget)
-        return;
-
-    UUserWidget* Widget{ LifeBarWidget->GetUserWidgetObject() };
-    if (!Widget)
+    if (Stat != EUpgradeStat::MaxHealth)
         return;
 
-    // Set the OwningActor property on the widget
-    FObjectProperty* Prop{ FindFProperty<FObjectProperty>(Widget->GetClass(), TEXT("OwningActor")) };
-    if (!Prop)
-        return;
+    float oldMax{ CurrentMaxHealth };
+    CurrentMaxHealth = FMath::Max(1.f, MaxHealthStat->Apply(MaxHealth));
 
-    void* ValuePtr = Prop->ContainerPtrToValuePtr<void>(Widget);
-    Prop->SetObjectPropertyValue(ValuePtr, GetOwner());
-}
\ No newline at end of file
+    // Heal the gained HP so the upgrade feels rewarding
+    CurrentHealth = FMath::Clamp(CurrentHealth + (CurrentMaxHealth - oldMax), 0.f, CurrentMaxHealth);
+}
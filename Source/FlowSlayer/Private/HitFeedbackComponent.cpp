@@ -1,4 +1,5 @@
 #include "HitFeedbackComponent.h"
+#include "FlowSlayerStats.h"
 
 UHitFeedbackComponent::UHitFeedbackComponent()
 {
@@ -17,6 +18,8 @@ void UHitFeedbackComponent::BeginPlay()
 
 void UHitFeedbackComponent::OnLandHit(const FVector& hitLocation)
 {
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_HitFeedbackOnLandHit);
+
     ApplyHitstop();
     ApplyHitShake(LandedShakeAmplitude);
     SpawnHitVFX(hitLocation);
@@ -32,6 +35,15 @@ void UHitFeedbackComponent::OnReceiveHit(const FVector& attackerLocation, float
     ApplyHitFlash();
 }
 
+void UHitFeedbackComponent::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+    for (const TSoftObjectPtr<UNiagaraSystem>& system : HitParticlesSystemArray)
+    {
+        if (!system.IsNull())
+            OutAssets.AddUnique(system.ToSoftObjectPath());
+    }
+}
+
 void UHitFeedbackComponent::ApplyKnockback(const FVector& attackerLocation, float knockbackForce, float upKnockbackForce)
 {
     if (!OwnerCharacter)
@@ -53,6 +65,7 @@ void UHitFeedbackComponent::ApplyHitstop()
 
     TWeakObjectPtr<ACharacter> weakOwner{ OwnerCharacter };
     FTimerHandle hitstopTimer;
+    FS_INC_COUNTER(TimersCreated);
     GetWorld()->GetTimerManager().SetTimer(
         hitstopTimer,
         [weakOwner]()
@@ -80,6 +93,7 @@ void UHitFeedbackComponent::ApplyHitShake(float shakeAmplitude)
 
     TWeakObjectPtr<USkeletalMeshComponent> weakMesh{ ownerMesh };
 	TWeakObjectPtr<UHitFeedbackComponent> weakThis{ this };
+    FS_INC_COUNTER(TimersCreated);
     GetWorld()->GetTimerManager().SetTimer(
         HitShakeTimer,
         [weakThis, weakMesh, defaultRelativeLoc, offsetDirection, shakeAmplitude]() mutable
@@ -101,6 +115,7 @@ void UHitFeedbackComponent::ApplyHitShake(float shakeAmplitude)
     );
 
     FTimerHandle hitShakeStopTimer;
+    FS_INC_COUNTER(TimersCreated);
     GetWorld()->GetTimerManager().SetTimer(
         hitShakeStopTimer,
         [weakThis, weakMesh, defaultRelativeLoc]()
@@ -130,6 +145,7 @@ void UHitFeedbackComponent::ApplyHitFlash()
 
     TWeakObjectPtr<USkeletalMeshComponent> weakMesh{ ownerMesh };
     FTimerHandle hitFlashTimer;
+    FS_INC_COUNTER(TimersCreated);
     GetWorld()->GetTimerManager().SetTimer(
         hitFlashTimer,
         [weakMesh]() { if (weakMesh.IsValid()) weakMesh->SetOverlayMaterial(nullptr); },
@@ -147,9 +163,11 @@ void UHitFeedbackComponent::SpawnHitVFX(const FVector& location)
     if (!HitParticlesSystemArray.IsValidIndex(randIndex))
         return;
 
-    UNiagaraSystem* hitParticlesSystem{ HitParticlesSystemArray[randIndex] };
+    // Not resident yet = no VFX for this hit (cosmetic only, never worth a blocking load mid-combat)
+    UNiagaraSystem* hitParticlesSystem{ HitParticlesSystemArray[randIndex].Get() };
     if (hitParticlesSystem)
     {
+        LLM_SCOPE_BYTAG(FlowSlayer_VFX);
         UNiagaraFunctionLibrary::SpawnSystemAtLocation(
             GetWorld(),
             hitParticlesSystem,
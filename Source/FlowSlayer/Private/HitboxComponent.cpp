@@ -1,20 +1,151 @@
 #include "HitboxComponent.h"
+#include "FlowSlayerStats.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/OverlapResult.h"
+#include "DrawDebugHelpers.h"
+#include "FSHitboxTimelineSubsystem.h"
+#include "GameFramework/Character.h"
 
 UHitboxComponent::UHitboxComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UHitboxComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	OnActiveFrameStarted.BindUObject(this, &UHitboxComponent::HandleActiveFrameStarted);
-	OnActiveFrameStopped.BindUObject(this, &UHitboxComponent::HandleActiveFrameStopped);
+	TimelineSubsystem = GetWorld()->GetSubsystem<UFSHitboxTimelineSubsystem>();
+	checkf(TimelineSubsystem, TEXT("FATAL: [HitboxComponent] HitboxTimelineSubsystem not found."));
+
+	const ACharacter* character{ Cast<ACharacter>(GetOwner()) };
+	OwnerMesh = character ? character->GetMesh() : nullptr;
+
+	// Montage positions are advanced by the mesh tick
+	if (OwnerMesh)
+		AddTickPrerequisiteComponent(OwnerMesh);
+}
+
+void UHitboxComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	EvaluateTimeline(DeltaTime);
+}
+
+// ==================== TIMELINE ====================
+
+void UHitboxComponent::StartTimeline(UAnimMontage* montage)
+{
+    StopTimeline();
+
+    UAnimInstance* animInstance{ OwnerMesh ? OwnerMesh->GetAnimInstance() : nullptr };
+    if (!montage || !animInstance)
+        return;
+
+    TSharedRef<const FFSHitboxTimeline> timeline{ TimelineSubsystem->GetTimeline(montage) };
+    if (timeline->IsEmpty())
+        return;
+
+    PlayingMontage = montage;
+    PlayingTimeline = timeline;
+    OpenWindows.Init(false, timeline->Windows.Num());
+
+    // Slightly before the start position so a window starting on it counts as crossed
+    LastMontagePosition = animInstance->Montage_GetPosition(montage) - UE_KINDA_SMALL_NUMBER;
+    LastMontageSection = animInstance->Montage_GetCurrentSection(montage);
+
+    SetComponentTickEnabled(true);
+}
+
+void UHitboxComponent::StopTimeline()
+{
+    if (OpenWindows.Contains(true))
+        HandleActiveFrameStopped();
+
+    PlayingMontage = nullptr;
+    PlayingTimeline.Reset();
+    OpenWindows.Empty();
+
+    SetComponentTickEnabled(false);
+}
+
+void UHitboxComponent::EvaluateTimeline(float DeltaTime)
+{
+    UAnimInstance* animInstance{ OwnerMesh ? OwnerMesh->GetAnimInstance() : nullptr };
+    if (!PlayingTimeline || !animInstance || !animInstance->Montage_IsPlaying(PlayingMontage))
+    {
+        StopTimeline();
+        return;
+    }
+
+    const float position{ animInstance->Montage_GetPosition(PlayingMontage) };
+    const FName section{ animInstance->Montage_GetCurrentSection(PlayingMontage) };
+
+    // Jumped (section jump, loop, restart) rather than played: resync on the new position, nothing skipped is run —
+    // only the windows open at the landing position start. A section reached by playing into it is not a jump
+    if (IsMontageDiscontinuity(*animInstance, position, section, DeltaTime))
+    {
+        if (OpenWindows.Contains(true))
+            HandleActiveFrameStopped();
+
+        OpenWindows.Init(false, OpenWindows.Num());
+        LastMontagePosition = position - UE_KINDA_SMALL_NUMBER;
+    }
+
+    LastMontageSection = section;
+
+    const TArray<FFSHitboxWindow>& windows{ PlayingTimeline->Windows };
+    for (int32 i{ 0 }; i < windows.Num(); ++i)
+    {
+        const FFSHitboxWindow& window{ windows[i] };
+
+        // Sorted by start — the remaining windows are not reached yet
+        if (window.StartTime > position)
+            break;
+
+        const bool bWasOpen{ OpenWindows[i] };
+        const bool bOpen{ position < window.EndTime };
+        const bool bCrossed{ !bWasOpen && !bOpen && LastMontagePosition < window.StartTime };
+
+        if (bOpen || bCrossed)
+            HandleActiveFrameStarted(&window.Profile);
+
+        if ((bWasOpen && !bOpen) || bCrossed)
+            HandleActiveFrameStopped();
+
+        OpenWindows[i] = bOpen;
+    }
+
+    LastMontagePosition = position;
+}
+
+bool UHitboxComponent::IsMontageDiscontinuity(const UAnimInstance& animInstance, float position, FName section, float DeltaTime) const
+{
+    if (position < LastMontagePosition)
+        return true;
+
+    const float playRate{ FMath::Abs(animInstance.Montage_GetPlayRate(PlayingMontage) * PlayingMontage->RateScale) };
+    const float maxAdvance{ DeltaTime * playRate * discontinuityTolerance + UE_KINDA_SMALL_NUMBER };
+    if (position - LastMontagePosition > maxAdvance)
+        return true;
+
+    if (section == LastMontageSection)
+        return false;
+
+    // Played into the next section: its start lies in the interval just advanced over
+    const int32 sectionIndex{ PlayingMontage->GetSectionIndex(section) };
+    const float sectionStart{ sectionIndex != INDEX_NONE ? PlayingMontage->GetAnimCompositeSection(sectionIndex).GetTime() : position };
+    return sectionStart <= LastMontagePosition || sectionStart > position;
 }
 
+// ==================== DETECTION ====================
+
 void UHitboxComponent::HandleActiveFrameStarted(const FHitboxProfile* hitboxProfile)
 {
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_HitboxActiveFrameStarted);
+
     if (!hitboxProfile)
         return;
 
@@ -56,6 +187,7 @@ void UHitboxComponent::DetectWeaponSweep(float radius, bool bShowDebugLines, flo
     EDrawDebugTrace::Type debugTrace{ bShowDebugLines ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None };
     TArray<FHitResult> outHits;
 
+    FS_INC_COUNTER(SceneQueries);
     UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), start, end, radius, objectsType, false, actorsToIgnore, debugTrace, outHits, true,
         FLinearColor::Red, FLinearColor::Green, debugLinesDuration);
 
@@ -67,43 +199,39 @@ void UHitboxComponent::DetectSphere(float range, const FVector& offset, bool bSh
     const AActor* owner{ GetOwner() };
     FVector worldOffset{ owner->GetActorTransform().TransformVector(offset) };
     FVector center{ owner->GetActorLocation() + worldOffset };
+    FCollisionShape shape{ FCollisionShape::MakeSphere(range) };
 
-    TArray<TEnumAsByte<EObjectTypeQuery>> objectsType{ EObjectTypeQuery::ObjectTypeQuery3 };
-    TArray<AActor*> actorsToIgnore{ GetOwner() };
-    EDrawDebugTrace::Type debugTrace{ bShowDebugLines ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None };
-    TArray<FHitResult> outHits;
+    TArray<FOverlapResult> overlaps;
+    OverlapPawns(center, FQuat::Identity, shape, overlaps);
 
-    UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), center, center, range, objectsType, false, actorsToIgnore, debugTrace, outHits, true,
-        FLinearColor::Red, FLinearColor::Green, debugLinesDuration);
+    if (bShowDebugLines)
+        DrawDebugSphere(GetWorld(), center, range, 12, overlaps.IsEmpty() ? FColor::Red : FColor::Green, false, debugLinesDuration);
 
-    ProcessHits(outHits);
+    ProcessOverlaps(overlaps, center, FQuat::Identity, shape);
 }
 
 void UHitboxComponent::DetectCone(float range, float halfAngleDeg, const FVector& offset, bool bShowDebugLines, float debugLinesDuration)
 {
-    TArray<TEnumAsByte<EObjectTypeQuery>> objectsType{ EObjectTypeQuery::ObjectTypeQuery3 };
-    TArray<AActor*> actorsToIgnore{ GetOwner(), OwnerWeapon };
-    TArray<FHitResult> outHits;
-
     const AActor* owner{ GetOwner() };
     FVector worldOffset{ owner->GetActorTransform().TransformVector(offset) };
     FVector center{ owner->GetActorLocation() + worldOffset };
+    FCollisionShape shape{ FCollisionShape::MakeSphere(range) };
 
-    UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), center, center, range, objectsType, false, actorsToIgnore, EDrawDebugTrace::None, outHits, true);
+    TArray<FOverlapResult> outOverlaps;
+    OverlapPawns(center, FQuat::Identity, shape, outOverlaps);
 
-    TArray<FHitResult> coneHits;
+    TArray<FOverlapResult> coneOverlaps;
     const float cosHalfAngle{ FMath::Cos(FMath::DegreesToRadians(halfAngleDeg)) };
     FVector forward{ owner->GetActorForwardVector() };
-    for (const FHitResult& hit : outHits)
+    for (const FOverlapResult& overlap : outOverlaps)
     {
-        if (!hit.GetActor())
+        if (!overlap.GetActor())
             continue;
 
-        FVector dirToTarget{ (hit.GetActor()->GetActorLocation() - center).GetSafeNormal() };
+        FVector dirToTarget{ (overlap.GetActor()->GetActorLocation() - center).GetSafeNormal() };
         float dot{ static_cast<float>(FVector::DotProduct(forward, dirToTarget)) };
-
         if (dot >= cosHalfAngle)
-            coneHits.Add(hit);
+            coneOverlaps.Add(overlap);
     }
 
     if (bShowDebugLines)
@@ -114,7 +242,7 @@ void UHitboxComponent::DetectCone(float range, float halfAngleDeg, const FVector
             12, FColor::Yellow, false, debugLinesDuration);
     }
 
-    ProcessHits(coneHits);
+    ProcessOverlaps(coneOverlaps, center, FQuat::Identity, shape);
 }
 
 void UHitboxComponent::DetectBox(const FVector& extent, float range, const FVector& offset, bool bShowDebugLines, float debugLinesDuration)
@@ -122,33 +250,161 @@ void UHitboxComponent::DetectBox(const FVector& extent, float range, const FVect
     AActor* owner{ GetOwner() };
     FVector worldOffset{ owner->GetActorTransform().TransformVector(offset) };
     FVector center{ owner->GetActorLocation() + worldOffset + owner->GetActorForwardVector() * range };
-    FRotator rotation{ owner->GetActorRotation() };
+    FQuat rotation{ owner->GetActorQuat() };
+    FCollisionShape shape{ FCollisionShape::MakeBox(extent) };
 
-    TArray<FHitResult> outHits;
-    FCollisionQueryParams queryParams;
-    queryParams.AddIgnoredActor(owner);
+    TArray<FOverlapResult> overlaps;
+    OverlapPawns(center, rotation, shape, overlaps);
+
+    if (bShowDebugLines)
+        DrawDebugBox(GetWorld(), center, extent, rotation, FColor::Blue, false, debugLinesDuration);
+
+    ProcessOverlaps(overlaps, center, rotation, shape);
+}
+
+bool UHitboxComponent::OverlapPawns(const FVector& center, const FQuat& rotation, const FCollisionShape& shape, TArray<FOverlapResult>& outOverlaps) const
+{
+    FCollisionQueryParams queryParams{ SCENE_QUERY_STAT(FSHitboxOverlap), false, GetOwner() };
     queryParams.AddIgnoredActor(OwnerWeapon);
 
-    GetWorld()->SweepMultiByObjectType(outHits, center, center, FQuat(rotation), FCollisionObjectQueryParams(ECollisionChannel::ECC_Pawn),
-        FCollisionShape::MakeBox(extent), queryParams);
+    FS_INC_COUNTER(SceneQueries);
+    return GetWorld()->OverlapMultiByObjectType(outOverlaps, center, rotation, FCollisionObjectQueryParams(ECollisionChannel::ECC_Pawn), shape, queryParams);
+}
 
-    if (bShowDebugLines)
-        DrawDebugBox(GetWorld(), center, extent, FQuat(rotation), FColor::Blue, false, debugLinesDuration);
+FVector UHitboxComponent::ComputeImpactPoint(const FOverlapResult& overlap, const FVector& center, const FQuat& rotation, const FCollisionShape& shape)
+{
+    const UPrimitiveComponent* targetComponent{ overlap.GetComponent() };
+    if (!targetComponent)
+        return overlap.GetActor() ? overlap.GetActor()->GetActorLocation() : center;
 
-    ProcessHits(outHits);
+    // Point of the target's collision closest to the hitbox center
+    FVector targetPoint{ targetComponent->GetComponentLocation() };
+    if (const UCapsuleComponent* capsule{ Cast<UCapsuleComponent>(targetComponent) })
+    {
+        const float capsuleRadius{ capsule->GetScaledCapsuleRadius() };
+        const FVector axis{ capsule->GetUpVector() * capsule->GetScaledCapsuleHalfHeight_WithoutHemisphere() };
+        const FVector onAxis{ FMath::ClosestPointOnSegment(center, targetPoint - axis, targetPoint + axis) };
+        const FVector toCenter{ center - onAxis };
+        const double distance{ toCenter.Size() };
+        targetPoint = distance > UE_KINDA_SMALL_NUMBER ? onAxis + toCenter * (FMath::Min<double>(capsuleRadius, distance) / distance) : onAxis;
+    }
+    else
+    {
+        FVector pointOnBody;
+        if (targetComponent->GetClosestPointOnCollision(center, pointOnBody) >= 0.f)
+            targetPoint = pointOnBody;
+    }
+
+    // Clamped into the hitbox shape: the contact is where both volumes meet
+    if (shape.IsBox())
+    {
+        const FVector extent{ shape.GetBox() };
+        const FVector local{ rotation.UnrotateVector(targetPoint - center) };
+        return center + rotation.RotateVector(local.BoundToBox(-extent, extent));
+    }
+
+    return center + (targetPoint - center).GetClampedToMaxSize(shape.GetSphereRadius());
 }
 
 void UHitboxComponent::ProcessHits(const TArray<FHitResult>& hits)
 {
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_HitboxProcessHits);
+    FS_INC_COUNTER_BY(HitsProcessed, hits.Num());
+
     for (const FHitResult& hitResult : hits)
+        RegisterHit(hitResult.GetActor(), hitResult.ImpactPoint);
+}
+
+void UHitboxComponent::ProcessOverlaps(const TArray<FOverlapResult>& overlaps, const FVector& center, const FQuat& rotation, const FCollisionShape& shape)
+{
+    FS_SCOPE_CYCLE_COUNTER(STAT_FS_HitboxProcessHits);
+    FS_INC_COUNTER_BY(HitsProcessed, overlaps.Num());
+
+    for (const FOverlapResult& overlap : overlaps)
     {
-        AActor* hitActor{ hitResult.GetActor() };
+        AActor* hitActor{ overlap.GetActor() };
         if (!hitActor || ActorsHitThisAttack.Contains(hitActor))
             continue;
 
-        ActorsHitThisAttack.Add(hitActor);
+        RegisterHit(hitActor, ComputeImpactPoint(overlap, center, rotation, shape));
+    }
+}
+
+void UHitboxComponent::RegisterHit(AActor* hitActor, const FVector& impactPoint)
+{
+    if (!hitActor || ActorsHitThisAttack.Contains(hitActor))
+        return;
+
+    ActorsHitThisAttack.Add(hitActor);
 
-        if (hitActor->Implements<UFSDamageable>())
-            OnHitboxHitLanded.ExecuteIfBound(hitActor, hitResult.ImpactPoint);
+    if (hitActor->Implements<UFSDamageable>())
+    {
+        FS_INC_COUNTER(DelegateBroadcasts);
+        OnHitboxHitLanded.ExecuteIfBound(hitActor, impactPoint);
     }
-}
\ No newline at end of file
+}
+
+// ==================== BENCHMARK ====================
+
+#if !UE_BUILD_SHIPPING
+/**
+ * fs.Hitbox.Benchmark [Iterations] [Range]
+ * Times the same sphere / box hitbox around the local player as a zero-length sweep (previous implementation)
+ * and as an overlap + analytic impact point, then logs the average cost per query.
+ */
+static FAutoConsoleCommandWithWorldAndArgs HitboxBenchmarkCommand(
+    TEXT("fs.Hitbox.Benchmark"),
+    TEXT("Compares zero-length sweeps and overlaps for the hitbox shapes. Args: [Iterations=1000] [Range=200]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const APlayerController* playerController{ World ? World->GetFirstPlayerController() : nullptr };
+        const APawn* player{ playerController ? playerController->GetPawn() : nullptr };
+        if (!player)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[Hitbox] Benchmark needs a possessed player pawn."));
+            return;
+        }
+
+        const int32 iterations{ Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000 };
+        const float range{ Args.Num() > 1 ? FCString::Atof(*Args[1]) : 200.f };
+
+        const FVector center{ player->GetActorLocation() + player->GetActorForwardVector() * range * 0.5f };
+        const FQuat rotation{ player->GetActorQuat() };
+        const FCollisionObjectQueryParams objectParams{ ECollisionChannel::ECC_Pawn };
+        FCollisionQueryParams queryParams{ SCENE_QUERY_STAT(FSHitboxBenchmark), false, player };
+
+        const FCollisionShape shapes[]{ FCollisionShape::MakeSphere(range), FCollisionShape::MakeBox(FVector(range, range, range * 0.5f)) };
+        const TCHAR* shapeNames[]{ TEXT("Sphere"), TEXT("Box") };
+
+        TArray<FHitResult> hits;
+        TArray<FOverlapResult> overlaps;
+        for (int32 shapeIndex{ 0 }; shapeIndex < UE_ARRAY_COUNT(shapes); ++shapeIndex)
+        {
+            const FCollisionShape& shape{ shapes[shapeIndex] };
+
+            const double sweepStart{ FPlatformTime::Seconds() };
+            for (int32 i{ 0 }; i < iterations; ++i)
+            {
+                hits.Reset();
+                World->SweepMultiByObjectType(hits, center, center, rotation, objectParams, shape, queryParams);
+            }
+            const double sweepUs{ (FPlatformTime::Seconds() - sweepStart) * 1e6 / iterations };
+
+            FVector impactSink{ FVector::ZeroVector };
+            const double overlapStart{ FPlatformTime::Seconds() };
+            for (int32 i{ 0 }; i < iterations; ++i)
+            {
+                overlaps.Reset();
+                World->OverlapMultiByObjectType(overlaps, center, rotation, objectParams, shape, queryParams);
+                for (const FOverlapResult& overlap : overlaps)
+                    impactSink += UHitboxComponent::ComputeImpactPoint(overlap, center, rotation, shape);
+            }
+            const double overlapUs{ (FPlatformTime::Seconds() - overlapStart) * 1e6 / iterations };
+
+            // The impact sum is logged so the analytic part cannot be optimized out
+            UE_LOG(LogTemp, Log, TEXT("[Hitbox] Benchmark %s (range %.0f, %d targets, %d iterations): sweep %.2f us, overlap + impact %.2f us (%.0f%%) — impact sum %s"),
+                shapeNames[shapeIndex], range, overlaps.Num(), iterations, sweepUs, overlapUs,
+                sweepUs > 0.0 ? overlapUs / sweepUs * 100.0 : 0.0, *impactSink.ToCompactString());
+        }
+    }));
+#endif
@@ -1,10 +1,154 @@
 #include "ProgressionComponent.h"
+#include "FlowSlayerStats.h"
 #include "FSWeapon.h"
-#include "Algo/RandomShuffle.h"
+#include "FSStatsComponent.h"
+
+namespace
+{
+	/** Sampling key of one candidate — kept in a min-heap so the weakest of the current picks is on top */
+	struct FWeightedKey
+	{
+		float Key;
+		int32 Index;
+
+		bool operator<(const FWeightedKey& Other) const { return Key < Other.Key; }
+	};
+
+	/**
+	 * Weighted random draw of up to Count distinct indices in [0, NumCandidates), without replacement.
+	 * Single pass, O(N log Count): each candidate gets the key ln(u) / w and the Count largest keys win
+	 * (same distribution as drawing one at a time proportionally to the weights, removing the pick each time).
+	 * Candidates with a weight <= 0 are never drawn.
+	 */
+	template <typename WeightGetter>
+	void DrawWeighted(int32 NumCandidates, int32 Count, WeightGetter&& GetWeight, TArray<int32>& OutIndices)
+	{
+		OutIndices.Reset();
+		if (Count <= 0 || NumCandidates <= 0)
+			return;
+
+		TArray<FWeightedKey, TInlineAllocator<8>> heap;
+		heap.Reserve(Count);
+
+		for (int32 i{ 0 }; i < NumCandidates; i++)
+		{
+			float weight{ GetWeight(i) };
+			if (weight <= 0.f)
+				continue;
+
+			float key{ FMath::Loge(FMath::Max(FMath::FRand(), UE_SMALL_NUMBER)) / weight };
+
+			if (heap.Num() < Count)
+				heap.HeapPush(FWeightedKey{ key, i });
+			else if (key > heap.HeapTop().Key)
+			{
+				heap.HeapPopDiscard(EAllowShrinking::No);
+				heap.HeapPush(FWeightedKey{ key, i });
+			}
+		}
+
+		OutIndices.Reserve(heap.Num());
+		for (const FWeightedKey& pick : heap)
+			OutIndices.Add(pick.Index);
+	}
+}
 
 UProgressionComponent::UProgressionComponent()
 {
 	PrimaryComponentTick.bCanEverTick = false;
+
+	ResetWeaponPartHandles();
+}
+
+void UProgressionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	StatsComponent = GetOwner()->FindComponentByClass<UFSStatsComponent>();
+	if (!StatsComponent)
+		UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] Owner has no UFSStatsComponent — upgrades will have no stat effect."));
+
+	BuildRewardIndex();
+}
+
+void UProgressionComponent::ResetWeaponPartHandles()
+{
+	for (auto& slotHandles : WeaponPartHandles)
+	{
+		for (int32& partHandle : slotHandles)
+			partHandle = INDEX_NONE;
+	}
+}
+
+void UProgressionComponent::BuildRewardIndex()
+{
+	UpgradeRows.Reset();
+	UpgradeHandleByID.Reset();
+	UpgradePrerequisites.Reset();
+	UpgradeDependents.Reset();
+	EligibleUpgrades.Reset();
+	WeaponPartRows.Reset();
+	ResetWeaponPartHandles();
+
+	if (UpgradeTable)
+	{
+		UpgradeTable->ForeachRow<FUpgradeData>(TEXT("BuildRewardIndex"), [this](const FName& rowName, const FUpgradeData& upgrade)
+		{
+			int32 upgradeHandle{ UpgradeRows.Add(&upgrade) };
+			UpgradeHandleByID.Add(upgrade.UpgradeID, upgradeHandle);
+		});
+
+		UpgradePrerequisites.Init(INDEX_NONE, UpgradeRows.Num());
+		UpgradeDependents.SetNum(UpgradeRows.Num());
+
+		for (int32 upgradeHandle{ 0 }; upgradeHandle < UpgradeRows.Num(); upgradeHandle++)
+		{
+			const FUpgradeData& upgrade{ *UpgradeRows[upgradeHandle] };
+
+			// Tier 1 — drawable from the start
+			if (upgrade.PrerequisiteUpgradeID == NAME_None)
+			{
+				EligibleUpgrades.Add(upgradeHandle);
+				continue;
+			}
+
+			const int32* prerequisite{ UpgradeHandleByID.Find(upgrade.PrerequisiteUpgradeID) };
+			if (!prerequisite)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] Upgrade '%s' requires unknown upgrade '%s' — it will never be offered."),
+					*upgrade.UpgradeID.ToString(), *upgrade.PrerequisiteUpgradeID.ToString());
+				continue;
+			}
+
+			UpgradePrerequisites[upgradeHandle] = *prerequisite;
+			UpgradeDependents[*prerequisite].Add(upgradeHandle);
+		}
+	}
+
+	ActiveUpgrades.Init(false, UpgradeRows.Num());
+
+	if (WeaponPartDataTable)
+	{
+		WeaponPartDataTable->ForeachRow<FWeaponPartData>(TEXT("BuildRewardIndex"), [this](const FName& rowName, const FWeaponPartData& part)
+		{
+			int32 slotIndex{ static_cast<int32>(part.PartType) };
+			if (slotIndex >= WeaponPartSlotCount || part.Tier < 1 || part.Tier > WeaponPartMaxTier)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] Weapon part '%s' has an invalid slot/tier — ignored."), *part.PartID.ToString());
+				return;
+			}
+
+			int32& partHandle{ WeaponPartHandles[slotIndex][part.Tier - 1] };
+			if (partHandle != INDEX_NONE)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] Weapon part '%s' duplicates slot/tier of '%s' — ignored."),
+					*part.PartID.ToString(), *WeaponPartRows[partHandle]->PartID.ToString());
+				return;
+			}
+
+			partHandle = WeaponPartRows.Add(&part);
+		});
+	}
 }
 
 void UProgressionComponent::AddXP(int32 Amount)
@@ -41,107 +185,89 @@ TArray<FUpgradeData> UProgressionComponent::DrawUpgrades(int32 Count)
 		return result;
 	}
 
-	// Making a pool array of all the upgrades we don't have yet
-	TArray<const FUpgradeData*> pool;
-	for (auto& row : UpgradeTable->GetRowMap())
-	{
-		const FUpgradeData* upgrade{ reinterpret_cast<const FUpgradeData*>(row.Value) };
-		if (IsUpgradeEligible(upgrade))
-			pool.Add(upgrade);
-	}
+	TArray<int32> drawn;
+	DrawWeighted(EligibleUpgrades.Num(), Count, [this](int32 i) { return UpgradeRows[EligibleUpgrades[i]]->DrawWeight; }, drawn);
 
-	Algo::RandomShuffle(pool);
-
-	// Picking the first three randomized elements of the shuffled pool
-	for (int32 i{ 0 }; i < FMath::Min(Count, pool.Num()); i++)
-		result.Add(*pool[i]);
+	// Only the drawn rows are copied
+	result.Reserve(drawn.Num());
+	for (int32 i : drawn)
+		result.Add(*UpgradeRows[EligibleUpgrades[i]]);
 
 	return result;
 }
 
 void UProgressionComponent::SelectUpgrade(const FUpgradeData& Upgrade)
 {
-	UndoPreviousTier(Upgrade);
-
-	ActiveUpgradeIDs.Add(Upgrade.UpgradeID);
-	OnUpgradeSelected.Broadcast(Upgrade);
+	const int32* upgradeHandle{ UpgradeHandleByID.Find(Upgrade.UpgradeID) };
+	if (!upgradeHandle)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] SelectUpgrade: '%s' is not in UpgradeTable."), *Upgrade.UpgradeID.ToString());
+		return;
+	}
 
-	UE_LOG(LogTemp, Log, TEXT("[ProgressionComponent] Upgrade selected: %s"), *Upgrade.UpgradeID.ToString());
+	SelectUpgradeByHandle(*upgradeHandle);
 }
 
-bool UProgressionComponent::IsUpgradeEligible(const FUpgradeData* Upgrade) const
+void UProgressionComponent::SelectUpgradeByHandle(int32 UpgradeHandle)
 {
-	if (ActiveUpgradeIDs.Contains(Upgrade->UpgradeID))
-		return false;
+	if (!UpgradeRows.IsValidIndex(UpgradeHandle) || ActiveUpgrades[UpgradeHandle])
+		return;
 
-	// Tier gate: only available if prerequisite is already owned
-	bool bPrerequisiteMet{ Upgrade->PrerequisiteUpgradeID == NAME_None || ActiveUpgradeIDs.Contains(Upgrade->PrerequisiteUpgradeID) };
-	return bPrerequisiteMet;
-}
+	ActiveUpgrades[UpgradeHandle] = true;
+	EligibleUpgrades.RemoveSingleSwap(UpgradeHandle);
 
-FUpgradeData UProgressionComponent::BuildReverseUpgrade(const FUpgradeData& Upgrade) const
-{
-	FUpgradeData reverse{ Upgrade };
+	// Next tiers become drawable now that their prerequisite is owned
+	for (int32 dependent : UpgradeDependents[UpgradeHandle])
+	{
+		if (!ActiveUpgrades[dependent])
+			EligibleUpgrades.AddUnique(dependent);
+	}
+
+	const FUpgradeData& upgrade{ *UpgradeRows[UpgradeHandle] };
 
-	if (reverse.ValueType == EUpgradeValueType::Additive)
-		reverse.Value = -reverse.Value;
-	else
-		reverse.Value = (reverse.Value != 0.f) ? (1.f / reverse.Value) : 1.f;
+	// Values are tier totals — keying the modifier by chain makes T2 replace T1 instead of stacking on it
+	if (StatsComponent)
+	{
+		const FName source{ UpgradeRows[GetChainRoot(UpgradeHandle)]->UpgradeID };
 
-	return reverse;
+		// Same stat → SetModifier replaces the previous tier; different stat → drop it explicitly
+		const int32 previousHandle{ UpgradePrerequisites[UpgradeHandle] };
+		if (previousHandle != INDEX_NONE && UpgradeRows[previousHandle]->Stat != upgrade.Stat)
+			StatsComponent->RemoveModifier(UpgradeRows[previousHandle]->Stat, source);
+
+		StatsComponent->SetModifier(upgrade.Stat, source, upgrade.ValueType, upgrade.Value);
+	}
+
+	OnUpgradeSelected.Broadcast(upgrade);
+
+	UE_LOG(LogTemp, Log, TEXT("[ProgressionComponent] Upgrade selected: %s"), *upgrade.UpgradeID.ToString());
 }
 
-void UProgressionComponent::UndoPreviousTier(const FUpgradeData& Upgrade)
+int32 UProgressionComponent::GetChainRoot(int32 UpgradeHandle) const
 {
-	// No need to undo if :
-	// The new upgrade has no prerequisite
-	// The player hasn't the prerequisite upgrade for that new upgrade
-	if (Upgrade.PrerequisiteUpgradeID == NAME_None || !ActiveUpgradeIDs.Contains(Upgrade.PrerequisiteUpgradeID))
-		return;
+	// Bounded walk — a cyclic prerequisite chain in the DataTable cannot hang the game
+	int32 root{ UpgradeHandle };
+	for (int32 depth{ 0 }; depth < UpgradeRows.Num() && UpgradePrerequisites[root] != INDEX_NONE; depth++)
+		root = UpgradePrerequisites[root];
 
-	FUpgradeData* prereqData{ UpgradeTable->FindRow<FUpgradeData>(Upgrade.PrerequisiteUpgradeID, TEXT("UndoPreviousTier")) };
-	if (!prereqData)
-		return;
-
-	// If we are at TIER 2+ upgrade, we copy the prerequisite and negate that upgrade (back to default stat)
-	// So it doesn't add with the current upgrade (e.g.: old upgrade: 20% more dmg -> new upgrade 40% more damage -
-	// Current damage: +20% -> we delete that upgrade -> now +0% -> apply new upgrade -> +40% -> total: +40% and not +60%
-	OnUpgradeSelected.Broadcast(BuildReverseUpgrade(*prereqData));
+	return root;
 }
 
 TArray<FRewardCard> UProgressionComponent::DrawMixedRewards(int32 Count)
 {
-	TArray<FRewardCard> pool;
+	FS_SCOPE_CYCLE_COUNTER(STAT_FS_ProgressionDrawMixedRewards);
 
-	// Collect eligible upgrades
-	if (UpgradeTable)
-	{
-		for (auto& row : UpgradeTable->GetRowMap())
-		{
-			const FUpgradeData* upgrade{ reinterpret_cast<const FUpgradeData*>(row.Value) };
-			if (IsUpgradeEligible(upgrade))
-			{
-				FRewardCard card;
-				card.RewardType = ERewardType::Upgrade;
-				card.UpgradeData = *upgrade;
-				pool.Add(card);
-			}
-		}
-	}
+	TArray<FRewardCard> result;
 
-	// Collect eligible weapon parts (only the next tier per slot)
+	// Candidates = eligible upgrades followed by the next tier of each weapon slot
+	TArray<int32, TInlineAllocator<3>> partCandidates;
 	if (WeaponPartDataTable && EquippedWeapon)
 	{
-		for (auto& row : WeaponPartDataTable->GetRowMap())
+		for (EWeaponPartType slotType : { EWeaponPartType::Blade, EWeaponPartType::Handle, EWeaponPartType::Gem })
 		{
-			const FWeaponPartData* part{ reinterpret_cast<const FWeaponPartData*>(row.Value) };
-			if (IsWeaponPartEligible(*part))
-			{
-				FRewardCard card;
-				card.RewardType = ERewardType::WeaponPart;
-				card.WeaponPartData = *part;
-				pool.Add(card);
-			}
+			int32 partHandle{ GetNextWeaponPartHandle(slotType) };
+			if (partHandle != INDEX_NONE)
+				partCandidates.Add(partHandle);
 		}
 	}
 	else if (WeaponPartDataTable && !EquippedWeapon)
@@ -149,15 +275,69 @@ TArray<FRewardCard> UProgressionComponent::DrawMixedRewards(int32 Count)
 		UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] DrawMixedRewards: EquippedWeapon is null — weapon parts excluded from pool."));
 	}
 
-	Algo::RandomShuffle(pool);
+	const int32 upgradeCount{ EligibleUpgrades.Num() };
 
-	TArray<FRewardCard> result;
-	for (int32 i{ 0 }; i < FMath::Min(Count, pool.Num()); i++)
-		result.Add(pool[i]);
+	TArray<int32> drawn;
+	DrawWeighted(upgradeCount + partCandidates.Num(), Count, [this, upgradeCount, &partCandidates](int32 i)
+	{
+		return i < upgradeCount ? UpgradeRows[EligibleUpgrades[i]]->DrawWeight : WeaponPartRows[partCandidates[i - upgradeCount]]->DrawWeight;
+	}, drawn);
+
+	result.Reserve(drawn.Num());
+	for (int32 i : drawn)
+	{
+		FRewardCard card;
+		if (i < upgradeCount)
+		{
+			card.RewardType = ERewardType::Upgrade;
+			card.RowIndex = EligibleUpgrades[i];
+		}
+		else
+		{
+			card.RewardType = ERewardType::WeaponPart;
+			card.RowIndex = partCandidates[i - upgradeCount];
+		}
+		result.Add(card);
+	}
 
 	return result;
 }
 
+bool UProgressionComponent::GetCardUpgradeData(const FRewardCard& Card, FUpgradeData& OutUpgrade) const
+{
+	if (Card.RewardType != ERewardType::Upgrade || !UpgradeRows.IsValidIndex(Card.RowIndex))
+		return false;
+
+	OutUpgrade = *UpgradeRows[Card.RowIndex];
+	return true;
+}
+
+bool UProgressionComponent::GetCardWeaponPartData(const FRewardCard& Card, FWeaponPartData& OutWeaponPart) const
+{
+	if (Card.RewardType != ERewardType::WeaponPart || !WeaponPartRows.IsValidIndex(Card.RowIndex))
+		return false;
+
+	OutWeaponPart = *WeaponPartRows[Card.RowIndex];
+	return true;
+}
+
+void UProgressionComponent::SelectRewardCard(const FRewardCard& Card)
+{
+	if (Card.RewardType == ERewardType::Upgrade)
+	{
+		SelectUpgradeByHandle(Card.RowIndex);
+		return;
+	}
+
+	if (!WeaponPartRows.IsValidIndex(Card.RowIndex))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[ProgressionComponent] SelectRewardCard: invalid weapon part card (%d)."), Card.RowIndex);
+		return;
+	}
+
+	SelectWeaponPart(*WeaponPartRows[Card.RowIndex]);
+}
+
 void UProgressionComponent::SelectWeaponPart(const FWeaponPartData& WeaponPart)
 {
 	OnWeaponPartSelected.Broadcast(WeaponPart);
@@ -174,24 +354,30 @@ bool UProgressionComponent::ApplyRandomWeaponPartDrop()
 		return false;
 	}
 
-	// Shuffle slot order to avoid always trying Blade first
-	TArray<EWeaponPartType> slotOrder{ EWeaponPartType::Blade, EWeaponPartType::Handle, EWeaponPartType::Gem };
-	Algo::RandomShuffle(slotOrder);
-
-	for (EWeaponPartType slotType : slotOrder)
+	TArray<int32, TInlineAllocator<3>> partCandidates;
+	for (EWeaponPartType slotType : { EWeaponPartType::Blade, EWeaponPartType::Handle, EWeaponPartType::Gem })
 	{
-		const FWeaponPartData* nextPart{ FindNextPartForSlot(slotType) };
-		if (!nextPart)
-			continue;
+		int32 partHandle{ GetNextWeaponPartHandle(slotType) };
+		if (partHandle != INDEX_NONE)
+			partCandidates.Add(partHandle);
+	}
 
-		EquippedWeapon->EquipPart(slotType, *nextPart);
-		UE_LOG(LogTemp, Log, TEXT("[ProgressionComponent] Drop applied: %s T%d"), *nextPart->PartID.ToString(), nextPart->Tier);
-		OnItemDrop.Broadcast(*nextPart);
-		return true;
+	if (partCandidates.IsEmpty())
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ProgressionComponent] ApplyRandomWeaponPartDrop: all slots at T3, nothing to drop."));
+		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[ProgressionComponent] ApplyRandomWeaponPartDrop: all slots at T3, nothing to drop."));
-	return false;
+	// Weighted pick of the slot to upgrade — a drop always lands, even if every candidate has a zero weight
+	TArray<int32> drawn;
+	DrawWeighted(partCandidates.Num(), 1, [this, &partCandidates](int32 i) { return WeaponPartRows[partCandidates[i]]->DrawWeight; }, drawn);
+
+	const FWeaponPartData& nextPart{ *WeaponPartRows[partCandidates[drawn.IsEmpty() ? 0 : drawn[0]]] };
+
+	EquippedWeapon->EquipPart(nextPart.PartType, nextPart);
+	UE_LOG(LogTemp, Log, TEXT("[ProgressionComponent] Drop applied: %s T%d"), *nextPart.PartID.ToString(), nextPart.Tier);
+	OnItemDrop.Broadcast(nextPart);
+	return true;
 }
 
 void UProgressionComponent::SetEquippedWeaponRef(AFSWeapon* Weapon)
@@ -199,39 +385,30 @@ void UProgressionComponent::SetEquippedWeaponRef(AFSWeapon* Weapon)
 	EquippedWeapon = Weapon;
 }
 
-bool UProgressionComponent::IsWeaponPartEligible(const FWeaponPartData& PartData) const
+int32 UProgressionComponent::GetNextWeaponPartHandle(EWeaponPartType SlotType) const
 {
 	if (!EquippedWeapon)
-		return false;
+		return INDEX_NONE;
+
+	int32 currentTier{ EquippedWeapon->GetCurrentTier(SlotType) };
+	if (currentTier < 0 || currentTier >= WeaponPartMaxTier)
+		return INDEX_NONE;
 
-	int32 currentTier{ EquippedWeapon->GetCurrentTier(PartData.PartType) };
-	return PartData.Tier == currentTier + 1;
+	// Slot [tier - 1] of the next tier is the current tier
+	int32 partHandle{ WeaponPartHandles[static_cast<int32>(SlotType)][currentTier] };
+	return WeaponPartRows.IsValidIndex(partHandle) ? partHandle : INDEX_NONE;
 }
 
 const FWeaponPartData* UProgressionComponent::FindNextPartForSlot(EWeaponPartType SlotType) const
 {
-	if (!WeaponPartDataTable || !EquippedWeapon)
-		return nullptr;
-
-	int32 currentTier{ EquippedWeapon->GetCurrentTier(SlotType) };
-	if (currentTier >= 3)
-		return nullptr;
-
-	int32 targetTier{ currentTier + 1 };
-
-	for (auto& row : WeaponPartDataTable->GetRowMap())
-	{
-		const FWeaponPartData* part{ reinterpret_cast<const FWeaponPartData*>(row.Value) };
-		if (part->PartType == SlotType && part->Tier == targetTier)
-			return part;
-	}
-
-	return nullptr;
+	int32 partHandle{ GetNextWeaponPartHandle(SlotType) };
+	return partHandle != INDEX_NONE ? WeaponPartRows[partHandle] : nullptr;
 }
 
 bool UProgressionComponent::HasUpgrade(FName UpgradeID) const
 {
-	return ActiveUpgradeIDs.Contains(UpgradeID);
+	const int32* upgradeHandle{ UpgradeHandleByID.Find(UpgradeID) };
+	return upgradeHandle && ActiveUpgrades[*upgradeHandle];
 }
 
 float UProgressionComponent::GetXPRatio() const
@@ -1,4 +1,6 @@
 #include "RewardChest.h"
+#include "FSActorRegistrySubsystem.h"
+#include "FSWorldMarkerSubsystem.h"
 
 ARewardChest::ARewardChest()
 {
@@ -13,12 +15,6 @@ ARewardChest::ARewardChest()
 	OverlapZone->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	OverlapZone->OnComponentBeginOverlap.AddUniqueDynamic(this, &ARewardChest::HandleOnBeginOverlap);
 	OverlapZone->OnComponentEndOverlap.AddUniqueDynamic(this, &ARewardChest::HandleOnEndOverlap);
-
-	KeyUIWidget = CreateDefaultSubobject<UWidgetComponent>(TEXT("KeyUIWidget"));
-	KeyUIWidget->SetupAttachment(RootComponent);
-	KeyUIWidget->SetWidgetSpace(EWidgetSpace::Screen);
-	KeyUIWidget->SetDrawSize(FVector2D(40.0f, 40.0f));
-	KeyUIWidget->SetVisibility(false);
 }
 
 void ARewardChest::ShowChest()
@@ -43,6 +39,20 @@ void ARewardChest::BeginPlay()
 	PlayerRef = PlayerController->GetPawn();
 
 	ChestMesh->SetVisibility(false, true);
+
+	if (UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() })
+		registry->RegisterRewardChest(this);
+}
+
+void ARewardChest::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() })
+		registry->UnregisterRewardChest(this);
+
+	if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+		markers->RemoveTarget(this);
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ARewardChest::OpenChest()
@@ -53,22 +63,29 @@ void ARewardChest::OpenChest()
 	ChestMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	ChestMesh->SetVisibility(false, true);
 	DisableInput(PlayerController);
+
+	if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+		markers->SetInteractPromptVisible(this, false);
 }
 
 void ARewardChest::HandleOnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
-	if (OtherActor == PlayerRef && KeyUIWidget)
+	if (OtherActor == PlayerRef)
 	{
-		KeyUIWidget->SetVisibility(true);
+		if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+			markers->SetInteractPromptVisible(this, true);
+
 		EnableInput(PlayerController);
 	}
 }
 
 void ARewardChest::HandleOnEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
 {
-	if (OtherActor == PlayerRef && KeyUIWidget)
+	if (OtherActor == PlayerRef)
 	{
-		KeyUIWidget->SetVisibility(false);
+		if (UFSWorldMarkerSubsystem* markers{ GetWorld()->GetSubsystem<UFSWorldMarkerSubsystem>() })
+			markers->SetInteractPromptVisible(this, false);
+
 		DisableInput(PlayerController);
 	}
 }
@@ -1,4 +1,13 @@
 #include "RunManager.h"
+#include "FSActorRegistrySubsystem.h"
+#include "FSProjectile.h"
+#include "NiagaraComponent.h"
+#include "Blueprint/UserWidget.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_EDITOR
+#include "EngineUtils.h"
+#endif
 
 ARunManager::ARunManager()
 {
@@ -18,10 +27,19 @@ void ARunManager::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
 
-	TArray<AActor*> existing;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ARunManager::StaticClass(), existing);
-	if (existing.Num() > 1)
-		UE_LOG(LogTemp, Error, TEXT("[RunManager] More than one RunManager in the level — only one is allowed."));
+	// Game worlds catch duplicates at registration time — this is only an editor placement hint
+	UWorld* world{ GetWorld() };
+	if (!world || world->IsGameWorld())
+		return;
+
+	for (TActorIterator<ARunManager> it(world); it; ++it)
+	{
+		if (*it != this)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[RunManager] More than one RunManager in the level — only one is allowed."));
+			break;
+		}
+	}
 }
 #endif
 
@@ -29,23 +47,37 @@ void ARunManager::BeginPlay()
 {
 	Super::BeginPlay();
 
-	TArray<AActor*> existing;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ARunManager::StaticClass(), existing);
-	if (existing.Num() > 1)
+	UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() };
+	if (!registry || !registry->RegisterRunManager(this))
 	{
 		UE_LOG(LogTemp, Error, TEXT("[RunManager] Duplicate detected — destroying self."));
 		Destroy();
 		return;
 	}
 
+	Arenas.Init(nullptr, ArenaLevels.Num());
+
+	// Arena managers register when their sublevel becomes visible — some may already be (e.g. initially loaded sublevels)
+	registry->OnArenaRegistered.AddUObject(this, &ARunManager::HandleOnArenaRegistered);
+	for (AFSArenaManager* arena : registry->GetArenas())
+		HandleOnArenaRegistered(arena);
+
 	StartRun();
 }
 
+void ARunManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UFSActorRegistrySubsystem* registry{ GetWorld()->GetSubsystem<UFSActorRegistrySubsystem>() })
+		registry->UnregisterRunManager(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ARunManager::StartRun()
 {
-	if (Arenas.IsEmpty())
+	if (ArenaLevels.IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[RunManager] No arenas assigned — run cannot start."));
+		UE_LOG(LogTemp, Warning, TEXT("[RunManager] No arena levels assigned — run cannot start."));
 		return;
 	}
 
@@ -57,24 +89,120 @@ void ARunManager::StartRun()
 
 	CurrentArenaIndex = 0;
 	RunStartTime = GetWorld()->GetTimeSeconds();
-	ActivateArena(Arenas[CurrentArenaIndex]);
 
-	UE_LOG(LogTemp, Log, TEXT("[RunManager] Run started. Total arenas: %d"), Arenas.Num());
+	// The player spawns in the first arena — load it before anything else, then preload the next one
+	RequestArenaLevel(CurrentArenaIndex, true);
+	RequestArenaLevel(CurrentArenaIndex + 1);
+
+	bPendingArenaActivation = true;
+	TryActivateCurrentArena();
+
+	UE_LOG(LogTemp, Log, TEXT("[RunManager] Run started. Total arenas: %d"), ArenaLevels.Num());
 }
 
 void ARunManager::StartNextArena()
 {
 	CurrentArenaIndex++;
 
-	if (!Arenas.IsValidIndex(CurrentArenaIndex))
+	if (!ArenaLevels.IsValidIndex(CurrentArenaIndex))
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[RunManager] StartNextArena called but no arena at index %d."), CurrentArenaIndex);
 		return;
 	}
 
+	// The player just left the previous arena through its portal — it will never be visited again
+	ReleaseArenaLevel(CurrentArenaIndex - 1);
+	RequestArenaLevel(CurrentArenaIndex);
+	RequestArenaLevel(CurrentArenaIndex + 1);
+
+	bPendingArenaActivation = true;
+	TryActivateCurrentArena();
+
+	UE_LOG(LogTemp, Log, TEXT("[RunManager] Entering arena %d / %d"), CurrentArenaIndex + 1, ArenaLevels.Num());
+
+	LogArenaMemorySnapshot(TEXT("ArenaEntered"));
+}
+
+void ARunManager::TryActivateCurrentArena()
+{
+	if (!bPendingArenaActivation || !Arenas.IsValidIndex(CurrentArenaIndex) || !Arenas[CurrentArenaIndex])
+		return;
+
+	bPendingArenaActivation = false;
 	ActivateArena(Arenas[CurrentArenaIndex]);
+}
+
+ULevelStreaming* ARunManager::GetArenaStreamingLevel(int32 ArenaIndex) const
+{
+	if (!ArenaLevels.IsValidIndex(ArenaIndex) || ArenaLevels[ArenaIndex].IsNull())
+		return nullptr;
+
+	return UGameplayStatics::GetStreamingLevel(this, FName(*ArenaLevels[ArenaIndex].GetLongPackageName()));
+}
+
+void ARunManager::RequestArenaLevel(int32 ArenaIndex, bool bBlockOnLoad)
+{
+	if (!ArenaLevels.IsValidIndex(ArenaIndex))
+		return;
+
+	ULevelStreaming* streamingLevel{ GetArenaStreamingLevel(ArenaIndex) };
+	if (!streamingLevel)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RunManager] Arena level %d is not in the persistent level's Levels list."), ArenaIndex);
+		return;
+	}
+
+	if (streamingLevel->ShouldBeLoaded() && streamingLevel->ShouldBeVisible())
+		return;
+
+	streamingLevel->bShouldBlockOnLoad = bBlockOnLoad;
+	streamingLevel->SetShouldBeLoaded(true);
+	streamingLevel->SetShouldBeVisible(true);
+
+	// bShouldBlockOnLoad only takes effect on the next streaming update — flush so the arena is loaded and visible on return
+	if (bBlockOnLoad)
+		GetWorld()->FlushLevelStreaming();
+
+	UE_LOG(LogTemp, Log, TEXT("[RunManager] Streaming in arena level %d%s."), ArenaIndex, bBlockOnLoad ? TEXT(" (blocking)") : TEXT(""));
+}
+
+void ARunManager::ReleaseArenaLevel(int32 ArenaIndex)
+{
+	if (!ArenaLevels.IsValidIndex(ArenaIndex))
+		return;
+
+	DeactivateArena(Arenas[ArenaIndex]);
+	Arenas[ArenaIndex] = nullptr;
+
+	ULevelStreaming* streamingLevel{ GetArenaStreamingLevel(ArenaIndex) };
+	if (!streamingLevel)
+		return;
+
+	streamingLevel->SetShouldBeVisible(false);
+	streamingLevel->SetShouldBeLoaded(false);
 
-	UE_LOG(LogTemp, Log, TEXT("[RunManager] Entering arena %d / %d"), CurrentArenaIndex + 1, Arenas.Num());
+	UE_LOG(LogTemp, Log, TEXT("[RunManager] Streaming out arena level %d."), ArenaIndex);
+}
+
+void ARunManager::HandleOnArenaRegistered(AFSArenaManager* Arena)
+{
+	if (!Arena)
+		return;
+
+	for (int32 i{ 0 }; i < ArenaLevels.Num(); i++)
+	{
+		ULevelStreaming* streamingLevel{ GetArenaStreamingLevel(i) };
+		if (streamingLevel && streamingLevel->GetLoadedLevel() == Arena->GetLevel())
+		{
+			Arenas[i] = Arena;
+
+			if (i == CurrentArenaIndex)
+				TryActivateCurrentArena();
+			return;
+		}
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[RunManager] Arena '%s' registered from a level that is not in ArenaLevels — ignored."), *Arena->GetName());
 }
 
 void ARunManager::ActivateArena(AFSArenaManager* Arena)
@@ -91,10 +219,24 @@ void ARunManager::ActivateArena(AFSArenaManager* Arena)
 	Arena->StartArena();
 }
 
+void ARunManager::DeactivateArena(AFSArenaManager* Arena)
+{
+	if (!Arena)
+		return;
+
+	Arena->OnArenaCleared.RemoveDynamic(this, &ARunManager::HandleOnArenaCleared);
+	Arena->OnEnemySpawned.RemoveDynamic(this, &ARunManager::HandleOnEnemySpawned);
+
+	if (AArenaPortal* portal{ Arena->GetExitPortal() })
+		portal->OnPlayerTeleported.RemoveDynamic(this, &ARunManager::StartNextArena);
+}
+
 void ARunManager::HandleOnArenaCleared()
 {
 	UE_LOG(LogTemp, Log, TEXT("[RunManager] Arena %d cleared."), CurrentArenaIndex + 1);
 
+	LogArenaMemorySnapshot(TEXT("ArenaCleared"));
+
 	if (IsLastArena())
 	{
 		ElapsedRunTime = GetWorld()->GetTimeSeconds() - RunStartTime;
@@ -114,7 +256,90 @@ void ARunManager::HandleOnEnemySpawned(AFSEnemy* spawnedEnemy)
 
 void ARunManager::HandleOnEnemyDeath(AFSEnemy* deadEnemy)
 {
+	// A dead enemy never broadcasts again — drop the binding instead of keeping it until the enemy is collected
+	deadEnemy->OnEnemyDeath.RemoveDynamic(this, &ARunManager::HandleOnEnemyDeath);
+
 	CurrentScore += deadEnemy->GetScoreReward();
 	OnScoreChanged.Broadcast(CurrentScore);
 }
 
+#if !UE_BUILD_SHIPPING
+namespace
+{
+	/** Live / destroyed-but-not-collected object counts of one class in one world or level */
+	struct FObjectCensus
+	{
+		int32 Live{ 0 };
+		int32 AwaitingGC{ 0 };
+	};
+
+	template<typename TObjectClass, typename TPredicate>
+	FObjectCensus CountObjects(TPredicate&& IsCounted)
+	{
+		FObjectCensus census;
+		for (TObjectIterator<TObjectClass> it(RF_ClassDefaultObject, true, EInternalObjectFlags::None); it; ++it)
+		{
+			if (!IsCounted(**it))
+				continue;
+
+			if (IsValid(*it))
+				census.Live++;
+			else
+				census.AwaitingGC++;
+		}
+		return census;
+	}
+
+	/** Counts the objects outered to the given level — actors it spawned and their components */
+	template<typename TObjectClass>
+	FObjectCensus CountLevelObjects(const ULevel* Level)
+	{
+		return CountObjects<TObjectClass>([Level](const TObjectClass& Object) { return Object.template GetTypedOuter<ULevel>() == Level; });
+	}
+
+	/** Counts the objects of the given world — for classes outered to the game instance, like widgets */
+	template<typename TObjectClass>
+	FObjectCensus CountWorldObjects(const UWorld* World)
+	{
+		return CountObjects<TObjectClass>([World](const TObjectClass& Object) { return Object.GetWorld() == World; });
+	}
+}
+#endif
+
+void ARunManager::LogArenaMemorySnapshot(const TCHAR* EventName)
+{
+#if !UE_BUILD_SHIPPING
+	if (!bLogMemorySnapshots)
+		return;
+
+	if (!bMemorySnapshotHeaderLogged)
+	{
+		bMemorySnapshotHeaderLogged = true;
+		UE_LOG(LogTemp, Log, TEXT("[ArenaMemCSV] Event,Arena,ArenaLevel,Time,Enemies,EnemiesAwaitingGC,Projectiles,ProjectilesAwaitingGC,WorldWidgets,WorldWidgetsAwaitingGC,NiagaraComponents,NiagaraAwaitingGC,UsedPhysicalMB,PeakUsedPhysicalMB"));
+	}
+
+	const ULevelStreaming* streamingLevel{ GetArenaStreamingLevel(CurrentArenaIndex) };
+	const ULevel* arenaLevel{ streamingLevel ? streamingLevel->GetLoadedLevel() : nullptr };
+	if (!arenaLevel)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[RunManager] %s memory snapshot skipped — arena level %d is not loaded."), EventName, CurrentArenaIndex);
+		return;
+	}
+
+	// Enemies and projectiles spawn into their arena's level (see AAFSSpawnZone::SpawnEnemy) — widgets have no level
+	const UWorld* world{ GetWorld() };
+	const FObjectCensus enemies{ CountLevelObjects<AFSEnemy>(arenaLevel) };
+	const FObjectCensus projectiles{ CountLevelObjects<AFSProjectile>(arenaLevel) };
+	const FObjectCensus widgets{ CountWorldObjects<UUserWidget>(world) };
+	const FObjectCensus niagara{ CountLevelObjects<UNiagaraComponent>(arenaLevel) };
+	const FPlatformMemoryStats memoryStats{ FPlatformMemory::GetStats() };
+
+	UE_LOG(LogTemp, Log, TEXT("[ArenaMemCSV] %s,%d,%s,%.2f,%d,%d,%d,%d,%d,%d,%d,%d,%.1f,%.1f"),
+		EventName, CurrentArenaIndex + 1, *arenaLevel->GetOuter()->GetName(), world->GetTimeSeconds(),
+		enemies.Live, enemies.AwaitingGC,
+		projectiles.Live, projectiles.AwaitingGC,
+		widgets.Live, widgets.AwaitingGC,
+		niagara.Live, niagara.AwaitingGC,
+		memoryStats.UsedPhysical / (1024.0 * 1024.0), memoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+#endif
+}
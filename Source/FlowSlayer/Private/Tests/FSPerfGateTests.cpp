@@ -0,0 +1,178 @@
+#include "FSPerfGateSubsystem.h"
+#include "Misc/AutomationTest.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Tests/AutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFSPerfGateBudgetsTest, "FlowSlayer.PerfGate.Budgets",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FFSPerfGateBudgetsTest::RunTest(const FString& Parameters)
+{
+	const TSharedPtr<FJsonObject> scenarios{ UFSPerfGateSubsystem::LoadScenarios() };
+	if (!TestTrue(TEXT("Budgets file loads"), scenarios.IsValid()))
+		return false;
+
+	TestFalse(TEXT("Budgets file declares scenarios"), scenarios->Values.IsEmpty());
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& entry : scenarios->Values)
+	{
+		FFSPerfScenario scenario;
+		if (!TestTrue(FString::Printf(TEXT("Scenario '%s' parses"), *entry.Key), UFSPerfGateSubsystem::ParseScenario(*scenarios, entry.Key, scenario)))
+			continue;
+
+		TestFalse(FString::Printf(TEXT("Scenario '%s' has a budget"), *entry.Key), scenario.Budgets.IsEmpty());
+		TestFalse(FString::Printf(TEXT("Scenario '%s' has a Map"), *entry.Key), scenario.Map.IsEmpty());
+
+		// The gate exits with a scenario error on an unknown console variable — catch it before a CI run does
+		for (const TPair<FString, FString>& variable : scenario.ConsoleVariables)
+		{
+			TestNotNull(FString::Printf(TEXT("Scenario '%s' console variable '%s' exists"), *entry.Key, *variable.Key),
+				IConsoleManager::Get().FindConsoleVariable(*variable.Key));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFSPerfGatePercentileTest, "FlowSlayer.PerfGate.Percentile",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FFSPerfGatePercentileTest::RunTest(const FString& Parameters)
+{
+	TArray<float> values;
+	for (int32 i{ 100 }; i >= 1; --i)
+		values.Add(static_cast<float>(i));
+
+	TestEqual(TEXT("p95 of 1..100"), UFSPerfGateSubsystem::ComputePercentile(values, 0.95f), 95.f);
+	TestEqual(TEXT("p100 is the max"), UFSPerfGateSubsystem::ComputePercentile(values, 1.f), 100.f);
+	TestEqual(TEXT("p0 is the min"), UFSPerfGateSubsystem::ComputePercentile(values, 0.f), 1.f);
+	TestEqual(TEXT("Empty set"), UFSPerfGateSubsystem::ComputePercentile({}, 0.95f), 0.f);
+	TestEqual(TEXT("Single sample"), UFSPerfGateSubsystem::ComputePercentile({ 7.f }, 0.95f), 7.f);
+
+	return true;
+}
+
+/** Waits until the perf gate of the game world finished its scenario, then reports the result on the test */
+class FFSWaitForPerfGateScenario : public IAutomationLatentCommand
+{
+public:
+
+	FFSWaitForPerfGateScenario(FAutomationTestBase* InTest, const FString& InScenarioName, bool bInProvisional, double InTimeoutSeconds)
+		: Test(InTest), ScenarioName(InScenarioName), bProvisional(bInProvisional), TimeoutSeconds(InTimeoutSeconds)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		const UFSPerfGateSubsystem* perfGate{ FindPerfGate() };
+		if (!perfGate || !perfGate->IsFinished())
+		{
+			if (GetCurrentRunTime() < TimeoutSeconds)
+				return false;
+
+			Test->AddError(FString::Printf(TEXT("Scenario '%s' did not finish within %.0f s."), *ScenarioName, TimeoutSeconds));
+			UFSPerfGateSubsystem::SetAutomationScenario(FString{});
+			return true;
+		}
+
+		if (perfGate->GetResultCode() != 0 && perfGate->GetExceededBudgets().IsEmpty())
+			Test->AddError(FString::Printf(TEXT("Scenario '%s' could not run (exit code %d) — see the [PerfGate] log."), *ScenarioName, perfGate->GetResultCode()));
+
+		for (const FString& exceededBudget : perfGate->GetExceededBudgets())
+		{
+			const FString message{ FString::Printf(TEXT("Scenario '%s' exceeds its %s budget."), *ScenarioName, *exceededBudget) };
+			if (bProvisional)
+				Test->AddWarning(message + TEXT(" Budgets are provisional — record them from the report."));
+			else
+				Test->AddError(message);
+		}
+
+		UFSPerfGateSubsystem::SetAutomationScenario(FString{});
+		return true;
+	}
+
+private:
+
+	FAutomationTestBase* Test;
+	FString ScenarioName;
+	bool bProvisional;
+	double TimeoutSeconds;
+
+	/** Returns the gate of the game world running this scenario — null while the map is still loading */
+	const UFSPerfGateSubsystem* FindPerfGate() const
+	{
+		for (const FWorldContext& context : GEngine->GetWorldContexts())
+		{
+			UWorld* world{ context.World() };
+			if (!world || !world->IsGameWorld())
+				continue;
+
+			const UFSPerfGateSubsystem* perfGate{ world->GetSubsystem<UFSPerfGateSubsystem>() };
+			if (perfGate && perfGate->GetScenarioName() == ScenarioName)
+				return perfGate;
+		}
+
+		return nullptr;
+	}
+};
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FFSPerfGateScenarioTest, "FlowSlayer.PerfGate.Scenario",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FFSPerfGateScenarioTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	const TSharedPtr<FJsonObject> scenarios{ UFSPerfGateSubsystem::LoadScenarios() };
+	if (!scenarios)
+		return;
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& entry : scenarios->Values)
+	{
+		OutBeautifiedNames.Add(entry.Key);
+		OutTestCommands.Add(entry.Key);
+	}
+}
+
+bool FFSPerfGateScenarioTest::RunTest(const FString& Parameters)
+{
+	// Seconds a scenario may take — a CI agent with -nullrhi plays ~3000 frames well within it
+	constexpr double scenarioTimeoutSeconds{ 600.0 };
+
+	const TSharedPtr<FJsonObject> scenarios{ UFSPerfGateSubsystem::LoadScenarios() };
+	if (!TestTrue(TEXT("Budgets file loads"), scenarios.IsValid()))
+		return false;
+
+	// A/B scenarios read their baseline's report — queue the baseline chain first, whatever order the tests run in
+	TArray<FString> runOrder{ Parameters };
+	FFSPerfScenario scenario;
+	while (UFSPerfGateSubsystem::ParseScenario(*scenarios, runOrder[0], scenario) && !scenario.Baseline.IsEmpty() && !runOrder.Contains(scenario.Baseline))
+	{
+		runOrder.Insert(scenario.Baseline, 0);
+		scenario = FFSPerfScenario{};
+	}
+
+	for (const FString& scenarioName : runOrder)
+	{
+		scenario = FFSPerfScenario{};
+		if (!TestTrue(FString::Printf(TEXT("Scenario '%s' parses"), *scenarioName), UFSPerfGateSubsystem::ParseScenario(*scenarios, scenarioName, scenario))
+			|| !TestFalse(FString::Printf(TEXT("Scenario '%s' has a Map"), *scenarioName), scenario.Map.IsEmpty()))
+			return false;
+
+		// Latent commands run in order — the next scenario is only requested once the previous one finished.
+		// The map is always reopened: the gate is created with the world and reads its scenario on BeginPlay
+		ADD_LATENT_AUTOMATION_COMMAND(FDelayedFunctionLatentCommand([scenarioName, map = scenario.Map]()
+		{
+			UFSPerfGateSubsystem::SetAutomationScenario(scenarioName);
+			GEngine->Exec(AutomationCommon::GetAnyGameWorld(), *FString::Printf(TEXT("Open %s"), *map));
+		}, 0.f));
+		ADD_LATENT_AUTOMATION_COMMAND(FFSWaitForPerfGateScenario(this, scenarioName, scenario.bProvisional, scenarioTimeoutSeconds));
+	}
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "FSEnemy_Grunt.h"
 #include "FSEnemy_Runner.h"
 #include "FSEnemyAIController.h"
+#include "FSSpawnDirector.h"
 #include "Components/SphereComponent.h"
 #include "NavigationSystem.h"
 #include "AFSSpawnZone.generated.h"
@@ -28,10 +29,19 @@ public:
 	AAFSSpawnZone();
 
 	/**
-	 * Spawns a single enemy at a random valid position within the zone.
-	 * @return The spawned enemy, or nullptr if spawn failed.
+	 * Spawns a single enemy of the given class at a random valid position within the zone.
+	 * @return The spawned enemy, or nullptr if no valid position was found.
 	 */
-	AFSEnemy* SpawnEnemy();
+	AFSEnemy* SpawnEnemy(UClass* EnemyClass);
+
+	/** Appends one candidate per enemy class of this zone already streamed in — classes still loading are skipped */
+	void GatherSpawnCandidates(TArray<FFSSpawnCandidate>& OutCandidates);
+
+	/** Appends the enemy classes of this zone to a preload manifest */
+	void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
+	/** Appends what the resident enemy classes of this zone need (montages, VFX) — second preload pass once the classes are loaded */
+	void GatherEnemyDependencies(TArray<FSoftObjectPath>& OutAssets) const;
 
 protected:
 
@@ -44,9 +54,11 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "SpawnSettings")
 	USphereComponent* SpawnZoneComponent;
 
-	/** Pool table of enemy type to spawn from that zone */
+	/** Pool table of enemy type to spawn from that zone — the arena's spawn director picks among them
+	 *  Soft references — streamed in by the owning arena's preload manifest
+	 */
 	UPROPERTY(EditAnywhere, Category = "SpawnSettings")
-	TArray<TSubclassOf<AFSEnemy>> EnemyPoolSpawn;
+	TArray<TSoftClassPtr<AFSEnemy>> EnemyPoolSpawn;
 
 	/** When true, shows the spawn zone sphere in game and draws debug spheres at each NavMesh point found:
 	 *  green = accepted spawn position, red = rejected (player too close) */
@@ -76,7 +88,7 @@ protected:
 
 	/** Number of current tries to successfully spawn an enemy 
 	* This includes trying to find a valid transform (GetRandomTransform)
-	* And try to successfully spawn an AFSEnemy right after (SpawnEnemy() -> GetWorld()->SpawnActor(...))
+	* And try to successfully spawn an AFSEnemy right after (SpawnEnemy(...) -> GetWorld()->SpawnActor(...))
 	*/
 	int16 CurrentSpawnTries{ 0 };
 };
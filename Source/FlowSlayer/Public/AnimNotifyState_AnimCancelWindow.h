@@ -2,6 +2,7 @@
 #include "CoreMinimal.h"
 #include "../FlowSlayerCharacter.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotifyState_AnimCancelWindow.generated.h"
 
 UENUM(BlueprintType)
@@ -12,6 +13,13 @@ enum class EAnimCancelWindowActionType : uint8
 	Any
 };
 
+/** Per-mesh running state of a cancel window */
+struct FFSAnimCancelInstance : FFSNotifyInstanceData
+{
+	/** TRUE once OnAnimationCanceled has been broadcast — prevents firing multiple times per window */
+	bool bAnimCancelTrigger{ false };
+};
+
 /**
  * Defines a time window during an animation where the player can cancel into another action.
  * Used for combo transitions and skill-based animation canceling.
@@ -34,10 +42,6 @@ protected:
 
 private:
 
-	/** Cached reference to the FlowSlayer character */
-	UPROPERTY()
-	const AFlowSlayerCharacter* FSCharacter { nullptr };
-
 	/** Type of action that will cancel the current animation during this window */
 	UPROPERTY(EditAnywhere, Category = "AnimationCancel")
 	EAnimCancelWindowActionType CancelActionTrigger{ EAnimCancelWindowActionType::Any };
@@ -45,7 +49,4 @@ private:
 	/** BlendOutTime of the current animation when canceling */
 	UPROPERTY(EditAnywhere, Category = "AnimationCancel")
 	float CancelBlendOutTime{ 0.f };
-
-	/** TRUE once OnAnimationCanceled has been broadcast — prevents firing multiple times per window */
-	bool bAnimCancelTrigger{ false };
 };
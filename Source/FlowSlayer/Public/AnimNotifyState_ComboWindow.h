@@ -2,6 +2,7 @@
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
 #include "FSCombatComponent.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotifyState_ComboWindow.generated.h"
 
 /**
@@ -27,7 +28,4 @@ class FLOWSLAYER_API UAnimNotifyState_ComboWindow : public UAnimNotifyState
 
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
-
-	UPROPERTY()
-	UFSCombatComponent* CombatComp{ nullptr };
 };
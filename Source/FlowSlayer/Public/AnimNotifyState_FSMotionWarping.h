@@ -4,6 +4,7 @@
 #include "GameFramework/Character.h"
 #include "MotionWarpingComponent.h"
 #include "AnimNotifyState_MotionWarping.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotifyState_FSMotionWarping.generated.h"
 
 UENUM()
@@ -14,6 +15,25 @@ enum class EFSMotionWarpingAttackType : uint8
     Air,
 };
 
+/** Per-mesh running state of a warp window */
+struct FFSMotionWarpInstance : FFSNotifyInstanceData
+{
+    /** Enemy resolved in NotifyBegin — the window keeps warping toward it, no new search */
+    TWeakObjectPtr<const AActor> Target;
+
+    /** Warp target name of the root motion modifier */
+    FName WarpTargetName{ NAME_None };
+
+    /** Real time left in the warp window — the prediction horizon */
+    float Remaining{ 0.f };
+
+    /** Time until the next warp target refresh */
+    float UpdateCooldown{ 0.f };
+
+    /** Whether NotifyBegin took an air juggle hold that NotifyEnd must release */
+    bool bHoldingAirJuggle{ false };
+};
+
 /**
  * Custom Motion Warping notify state for FlowSlayer attacks.
  * Extends UAnimNotifyState_MotionWarping to automatically resolve the warp target
@@ -29,6 +49,7 @@ class FLOWSLAYER_API UAnimNotifyState_FSMotionWarping : public UAnimNotifyState_
 protected:
 
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
 private:
@@ -47,58 +68,71 @@ private:
 
 	/** Attack type during this instance lifetime 
     * Ground: Will ignore Z axis and will stay in MovementMode::Walking
-    * Launcher: Will not ignore Z axis. At NotifyBegin MovementMode will be switched to Flying then set back to Falling at NotifyEnd
+    * Launcher: Will not ignore Z axis. Holds the air juggle movement mode from NotifyBegin to NotifyEnd
     * Air: Will not ignore Z axis but will not change the current movement mode.
     */
 	UPROPERTY(EditAnywhere)
 	EFSMotionWarpingAttackType attackType{ EFSMotionWarpingAttackType::Ground };
 
-	/** If true, draws debug sphere at the warp target location */
+	/** If true, the nearest enemy search reads the lock-on async probe (positions one frame old) instead of querying synchronously */
 	UPROPERTY(EditAnywhere)
-	bool bDebugLines{ false };
+	bool bAllowLatentTargetSearch{ true };
+
+	/** If true, the warp target leads the enemy by its velocity over the rest of the window (intercept instead of current position) */
+	UPROPERTY(EditAnywhere, Category = "Prediction")
+	bool bPredictTargetMotion{ true };
 
-	/** Cached lock-on component reference, resolved in NotifyBegin */
-    UPROPERTY()
-    UFSLockOnComponent* LockOnCompRef{ nullptr };
+	/** Longest prediction horizon (s) — beyond it the enemy may well change direction */
+	UPROPERTY(EditAnywhere, Category = "Prediction", meta = (ClampMin = "0.0", EditCondition = "bPredictTargetMotion"))
+	float MaxPredictionTime{ 0.5f };
 
-	/** Cached character owner reference, resolved in NotifyBegin */
-    UPROPERTY()
-    ACharacter* PlayerOwner{ nullptr };
+	/** Minimum time between two warp target refreshes during the window (0 = every tick) */
+	UPROPERTY(EditAnywhere, Category = "Prediction", meta = (ClampMin = "0.0", EditCondition = "bPredictTargetMotion"))
+	float PredictionUpdateInterval{ 0.05f };
 
-    /** Cached MotionWarpingComponent reference, resolved in NotifyBegin */
-    UPROPERTY()
-    UMotionWarpingComponent* MotionWarpingComponent;
+	/** If true, draws debug sphere at the warp target location */
+	UPROPERTY(EditAnywhere)
+	bool bDebugLines{ false };
 
     /** Returns the best warp target: locked-on enemy if within radius, otherwise nearest enemy
+    * @param context Notify context of the mesh owner (lock-on, motion warping and character resolved)
     * @param searchRadius Maximum detection radius
     * @param debugLines Whether to draw debug sphere
     * @return Target actor or nullptr if none found within radius
     */
-    const AActor* GetTargetForMotionWarp(float searchRadius, bool debugLines = false);
+    const AActor* GetTargetForMotionWarp(const FFSNotifyContext& context, float searchRadius, bool debugLines = false) const;
+
+    /** Returns where the target will be once the warp window ends — current location if prediction is off
+    * Ground warps only lead along the ground plane
+    */
+    FVector PredictTargetLocation(const AActor* targetActor, float predictionTime) const;
+
+    /** Recomputes the warp target of a running window from its target's predicted location */
+    void UpdateWarpTarget(const FFSNotifyContext& context, FFSMotionWarpInstance& warp) const;
 
     /** Setup motion warp for air-based attacks (air combos, aerial slams)
-    * Enables MOVE_Flying to suppress gravity during the warp window.
+    * Launchers hold the owner in the air juggle mode during the warp window (released in NotifyEnd).
     * @param motionWarpingTargetName Name of the warp target, must match the RootMotionModifier's WarpTargetName
-    * @param targetActor Enemy to warp toward
+    * @param enemyLocation (Predicted) enemy location to warp toward
     * @param zOffset Vertical offset added to enemy position (positive = higher, negative = lower)
     * @param forwardOffset Distance subtracted along the direction to enemy to avoid overshooting
     * @param debugLines Whether to draw debug sphere at warp target
     */
-    void SetupAirAttackMotionWarp(FName motionWarpingTargetName, const AActor* targetActor, float zOffset = 0.f, float forwardOffset = 0.f, bool debugLines = false);
+    void SetupAirAttackMotionWarp(const FFSNotifyContext& context, FName motionWarpingTargetName, const FVector& enemyLocation, float zOffset = 0.f, float forwardOffset = 0.f, bool debugLines = false) const;
 
     /** Setup motion warp for ground-based attacks (dash attacks, ground slams)
     * Does NOT change movement mode (stays in MOVE_Walking).
     * @param motionWarpingTargetName Name of the warp target, must match the RootMotionModifier's WarpTargetName
-    * @param targetActor Enemy to warp toward
+    * @param enemyLocation (Predicted) enemy location to warp toward
     * @param forwardOffset Distance subtracted along forward vector to avoid overshooting
     * @param debugLines Whether to draw debug sphere at warp target
     */
-    void SetupGroundAttackMotionWarp(FName motionWarpingTargetName, const AActor* targetActor, float forwardOffset = 0.f, bool debugLines = false);
+    void SetupGroundAttackMotionWarp(const FFSNotifyContext& context, FName motionWarpingTargetName, const FVector& enemyLocation, float forwardOffset = 0.f, bool debugLines = false) const;
 
-    /** Sphere traces around the player to find the nearest living enemy within radius
+    /** Overlaps a sphere around the player to find the nearest living enemy within radius
     * @param distanceRadius Sphere radius in cm
     * @param debugLines Whether to draw debug sphere
     * @return Nearest enemy actor or nullptr if none found
     */
-    AActor* GetNearestEnemyFromPlayer(float distanceRadius, bool debugLines = false) const;
+    AActor* GetNearestEnemyFromPlayer(const FFSNotifyContext& context, float distanceRadius, bool debugLines = false) const;
 };
@@ -2,33 +2,31 @@
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
 #include "HitboxComponent.h"
-#include "FSEnemy.h"
 #include "AnimNotifyState_Hitbox.generated.h"
 
 /**
- * Activates attack hitbox detection between NotifyBegin and NotifyEnd.
+ * Marks the active frames of an attack and the hitbox profile used during them.
  * Used for player and enemies hitboxes (UHitboxComponent)
+ *
+ * Authoring data only: the windows of a montage are compiled into a timeline (UFSHitboxTimelineSubsystem)
+ * that UHitboxComponent evaluates against the montage position — this notify has no runtime callback.
  */
 UCLASS(meta = (DisplayName = "Weapon active frame"))
 class FLOWSLAYER_API UAnimNotifyState_Hitbox : public UAnimNotifyState
 {
 	GENERATED_BODY()
 
+public:
+
 	UAnimNotifyState_Hitbox();
-	
-	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
-	virtual void NotifyTick(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
-	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+
+	const FHitboxProfile& GetHitboxProfile() const { return HitboxProfile; }
+
+private:
 
 	/** Hitbox profile of the attack occuring during this instance 
 	* Set up directly in the anim montage
 	*/
 	UPROPERTY(EditAnywhere, Category = "Hitbox")
 	FHitboxProfile HitboxProfile;
-
-	/** Player's weapon reference 
-	* nullptr if instigator is an enemy
-	*/
-	UPROPERTY()
-	const UHitboxComponent* HitboxComp{ nullptr };
 };
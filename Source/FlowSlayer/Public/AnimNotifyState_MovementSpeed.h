@@ -3,6 +3,7 @@
 #include "Animation/AnimNotifies/AnimNotifyState.h"
 #include "../FlowSlayerCharacter.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotifyState_MovementSpeed.generated.h"
 
 /**
@@ -37,10 +38,4 @@ protected:
 	/** Interpolation speed toward the target speed (used only when bSnapSpeed is false) */
 	UPROPERTY(EditAnywhere, Category = "Speed", meta = (ClampMin = "0.1", EditCondition = "!bSnapSpeed"))
 	float InterpolationSpeed{ 10.f };
-
-private:
-
-	/** Cached reference to the owning FlowSlayer character */
-	UPROPERTY()
-	AFlowSlayerCharacter* OwnerRef{ nullptr };
 };
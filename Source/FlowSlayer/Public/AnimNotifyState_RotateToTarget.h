@@ -3,6 +3,7 @@
 #include "Animation/AnimNotifies/AnimNotifyState.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotifyState_RotateToTarget.generated.h"
 
 /**
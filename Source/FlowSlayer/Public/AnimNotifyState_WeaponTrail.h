@@ -4,6 +4,7 @@
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "FSCombatComponent.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotifyState_WeaponTrail.generated.h"
 
 UCLASS(meta = (DisplayName = "WeaponTrail"))
@@ -15,7 +16,7 @@ public:
 
     UAnimNotifyState_WeaponTrail();
 
-    /** Sword trail Niagara VFX system asset */
+    /** Trail system of this swing on weapons whose tier table is empty — the weapon's TrailSystemsByBladeTier wins */
     UPROPERTY(EditAnywhere, Category = "VFX")
     UNiagaraSystem* NiagaraTrailSystem;
 
@@ -24,17 +25,6 @@ public:
 
 private:
 
-    UPROPERTY()
-    UFSCombatComponent* CombatCompRef{ nullptr };
-
-    UPROPERTY()
-    AFSWeapon* WeaponRef{ nullptr };
-
-    /** Trail component attached at weapon base socket */
-    UPROPERTY()
-    UNiagaraComponent* TrailNiagaraBaseCompRef{ nullptr };
-
-    /** Trail component attached at weapon tip socket */
-    UPROPERTY()
-    UNiagaraComponent* TrailNiagaraTipCompRef{ nullptr };
+    /** Returns the equipped weapon of the mesh owner (nullptr for owners without a combat component) */
+    static AFSWeapon* GetEquippedWeapon(const USkeletalMeshComponent* MeshComp);
 };
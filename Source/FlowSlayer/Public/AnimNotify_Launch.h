@@ -2,6 +2,7 @@
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotify.h"
 #include "GameFramework/Character.h"
+#include "FSNotifyContextProvider.h"
 #include "AnimNotify_Launch.generated.h"
 
 UCLASS(meta = (DisplayName = "LaunchOwner"))
@@ -8,15 +8,16 @@
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundCue.h"
 #include "Components/AudioComponent.h"
+#include "Engine/AssetManager.h"
 #include "ArenaPortal.generated.h"
 
 /** Broadcasted when the player has been teleported — RunManager listens to this to activate the next arena */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPlayerTeleported);
 
 /**
- * Placed in the level by the designer, hidden by default.
+ * Placed in the arena sublevel by the designer, hidden by default.
  * RunManager calls ShowPortal() when the current arena is cleared.
- * Teleports the player to DestinationActor on overlap.
+ * Teleports the player to DestinationActor (in the next arena sublevel) on overlap.
  * Notifies RunManager via OnPlayerTeleported — no direct dependency on RunManager.
  */
 UCLASS()
@@ -42,6 +43,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Portal")
 	void ShowPortal();
 
+	/** Appends the soft assets of this portal (VFX) to a preload manifest */
+	void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
 private:
 
 	/** Visual mesh of the portal */
@@ -52,9 +56,11 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Portal", meta = (AllowPrivateAccess = "true"))
 	UNiagaraComponent* NiagaraComponent;
 
-	/** Niagara system to play on the portal */
+	/** Niagara system to play on the portal
+	 * Soft reference — preloaded by the owning arena. If still streaming when the portal shows, it starts once loaded.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portal", meta = (AllowPrivateAccess = "true"))
-	UNiagaraSystem* PortalVFX;
+	TSoftObjectPtr<UNiagaraSystem> PortalVFX;
 
 	/** Looped Sound Cue to play on the portal */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Portal", meta = (AllowPrivateAccess = "true"))
@@ -74,9 +80,19 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Portal", meta = (AllowPrivateAccess = "true"))
 	UBoxComponent* OverlapBox;
 
-	/** Actor placed in the level representing the player arrival point in the next arena */
+	/**
+	 * Actor representing the player arrival point in the next arena.
+	 * Soft reference — it lives in the next arena sublevel, which RunManager streams in while this arena is fought.
+	 */
 	UPROPERTY(EditAnywhere, Category = "Portal")
-	AActor* DestinationActor;
+	TSoftObjectPtr<AActor> DestinationActor;
+
+	/** Frames TeleportPlayer waits for DestinationActor's sublevel before giving up (error logged) */
+	UPROPERTY(EditAnywhere, Category = "Portal", meta = (ClampMin = "1"))
+	int32 MaxTeleportRetryFrames{ 600 };
+
+	/** Frames already spent waiting for DestinationActor — reset on each new overlap */
+	int32 TeleportRetryFrames{ 0 };
 
 	/** Called when an actor overlaps the trigger box */
 	UFUNCTION()
@@ -84,6 +100,9 @@ private:
 		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex,
 		bool bFromSweep, const FHitResult& SweepResult);
 
+	/** Assigns and activates PortalVFX — requires the asset to be resident */
+	void ActivatePortalVFX();
+
 	/** Teleports the player to DestinationActor then broadcasts OnPlayerTeleported */
 	void TeleportPlayer(APawn* Player);
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Engine/DataTable.h"
+#include "Animation/AnimMontage.h"
 #include "CombatData.generated.h"
 
 UENUM(BlueprintType)
@@ -76,9 +77,11 @@ struct FAttackData : public FTableRowBase
     UPROPERTY(EditDefaultsOnly)
     FName Name{ "" };
 
-    /** Animation montage for this attack */
+    /** Animation montage for this attack
+    * Soft reference — the owner streams it in ahead of time (see ResolveMontage for the fallback)
+    */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
-    UAnimMontage* Montage{ nullptr };
+    TSoftObjectPtr<UAnimMontage> Montage;
 
     /** Damage dealt by this attack
      * Configured via InitializeComboAttackData()
@@ -142,6 +145,21 @@ struct FAttackData : public FTableRowBase
     /** TimerHandle of the cooldown */
     FTimerHandle CooldownTimer;
 
+    /** Returns the resident montage
+    * Fallback when the preload has not completed yet: blocking load, logged so the missing preload can be fixed
+    */
+    UAnimMontage* ResolveMontage() const
+    {
+        if (UAnimMontage* montage{ Montage.Get() })
+            return montage;
+
+        if (Montage.IsNull())
+            return nullptr;
+
+        UE_LOG(LogTemp, Warning, TEXT("[CombatData] Montage '%s' was not preloaded — loading synchronously."), *Montage.ToString());
+        return Montage.LoadSynchronous();
+    }
+
     /** Starts the attack cooldown, optionally scaled by an external multiplier (e.g. from AttackCooldown upgrade) */
     void StartCooldown(UWorld* world, float cooldownMultiplier = 1.f)
     {
@@ -188,7 +206,7 @@ struct FCombo
     int32 GetMaxComboIndex() const { return FMath::Max(0, Attacks.Num() - 1); }
 
     /** Checks if this combo data is valid and ready to use */
-    bool IsValid() const { return !Attacks.IsEmpty() && Attacks[0].Montage != nullptr; }
+    bool IsValid() const { return !Attacks.IsEmpty() && !Attacks[0].Montage.IsNull(); }
 
     /** Gets an attack montage at the specified index (returns nullptr if invalid) */
     const FAttackData* GetAttackAt(int32 Index) const
@@ -6,20 +6,38 @@
 #include "Kismet/GameplayStatics.h"
 #include "NiagaraComponent.h"
 #include "NiagaraFunctionLibrary.h"
-#include "UpgradeData.h"
+#include "FSStatsComponent.h"
 #include "DashComponent.generated.h"
 
+class UCurveFloat;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDashStarted, float, flowCost);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDashEnded);
 
 DECLARE_DELEGATE_RetVal_OneParam(bool, FCanAffordDash, float flowCost);
 
+/** Dash curve sampled at uniform alphas — linear lookups replace UCurveFloat::GetFloatValue per frame */
+struct FFSDashCurveLUT
+{
+    /** Curve value at alpha = i / (Num - 1) */
+    TArray<float> Samples;
+
+    /** Samples the curve at SampleCount uniform alphas over [0, 1] */
+    static FFSDashCurveLUT Build(const UCurveFloat* Curve, int32 SampleCount);
+
+    /** Linearly interpolated curve value at alpha, clamped to [0, 1] — alpha 1 returns the last sample exactly */
+    float Evaluate(float alpha) const;
+};
+
 /**
  * Handles the player's dash movement.
  *
  * Moves the character along a curve-driven trajectory over a fixed duration.
  * Input direction is snapped to 8 directions and converted to world space
  * relative to the camera. Dash is blocked during attacks, cooldown, and while airborne.
+ *
+ * The Dash notify only opens and closes the move window (BeginDashMove / FinishDashMove) — the component ticks
+ * the move itself from a precomputed curve LUT, sweeping in sub-steps so fast dashes never tunnel.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class UDashComponent : public UActorComponent
@@ -38,6 +56,22 @@ public:
     void EndDash();
 
     virtual void BeginPlay() override;
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    /**
+     * Starts moving the owner along the dash direction — called from the Dash notify's NotifyBegin.
+     * The world direction is recomputed from the current camera yaw (avoids a stale direction from the frames between StartDash and here).
+     * @param MoveCurve X = normalized time [0, 1], Y = normalized displacement [0, 1]
+     * @param Duration Real-time duration of the move, in seconds
+     */
+    void BeginDashMove(const UCurveFloat* MoveCurve, float Duration);
+
+    /**
+     * Stops the move. When the notify closes on schedule (within one frame of the move duration), the rest of the displacement
+     * is applied first so the dash covers the full curve distance whatever the frame rate.
+     * An interrupted or blended-out dash (CancelAttack, death, run completion) stops where it is instead of snapping forward.
+     */
+    void FinishDashMove();
 
     /** Broadcast when the dash starts — used to trigger animations, VFX, etc. */
     UPROPERTY(BlueprintAssignable)
@@ -71,10 +105,6 @@ public:
     UFUNCTION(BlueprintPure)
     bool CanDash() const;
 
-    /** Applies upgrade effects that concern the dash system (DashFlowCost stat) */
-    UFUNCTION()
-    void HandleOnUpgradeSelected(const FUpgradeData& Upgrade);
-
     /** Internal method called by delegate OnAttackingStarted in UFSCombatComponent */
     UFUNCTION()
     void OnAttackingStarted();
@@ -93,15 +123,33 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Dash", meta = (ClampMin = "0.1"))
     float MaxDashDuration{ 1.8f };
 
-    /** Flow cost per dash usage */
+    /** Base flow cost per dash usage — DashFlowCost stat applies on top */
     UPROPERTY(EditDefaultsOnly, Category = "Dash", meta = (ClampMin = "0.0", ClampMax = "100.0"))
     float FlowCost{ 10.f };
 
+    /** Number of uniform samples of the dash curve LUT */
+    UPROPERTY(EditDefaultsOnly, Category = "Dash|Movement", meta = (ClampMin = "2", ClampMax = "1024"))
+    int32 CurveSampleCount{ 64 };
+
+    /** Longest single sweep of a dash frame — longer displacements are split (capped by the capsule radius) */
+    UPROPERTY(EditDefaultsOnly, Category = "Dash|Movement", meta = (ClampMin = "1.0"))
+    float MaxSubstepDistance{ 30.f };
+
+    /** Upper bound of sweeps per frame — a hitch spreads over at most this many sub-steps */
+    UPROPERTY(EditDefaultsOnly, Category = "Dash|Movement", meta = (ClampMin = "1", ClampMax = "32"))
+    int32 MaxSubsteps{ 8 };
+
 private:
 
     /** Reference to the owning character, cached on BeginPlay */
     ACharacter* OwningPlayer{ nullptr };
 
+    /** DashFlowCost stat — cached from the owner's stats component on BeginPlay */
+    const FStatAggregate* FlowCostStat{ &FStatAggregate::Identity };
+
+    /** Returns the flow cost of a dash with the DashFlowCost stat applied */
+    float GetFlowCost() const { return FMath::Max(0.f, FlowCostStat->Apply(FlowCost)); }
+
     /** Snapped 2D input direction, set at StartDash — AnimNotifyState recomputes the world direction from this at NotifyBegin */
     FVector2D SnappedInput2D{ FVector2D::ZeroVector };
 
@@ -119,4 +167,36 @@ private:
 
     /** Safety fallback — fires EndDash() if NotifyEnd never triggers (e.g. montage interrupted before NotifyBegin) */
     FTimerHandle SafetyTimer;
+
+    // ==================== MOVEMENT ====================
+
+    /** World-space start position of the dash move, captured in BeginDashMove */
+    FVector MoveStart{ FVector::ZeroVector };
+
+    /** Full displacement of the dash move — direction * Distance */
+    FVector MoveDisplacement{ FVector::ZeroVector };
+
+    /** Time elapsed since the move started */
+    float MoveElapsed{ 0.f };
+
+    /** Real-time duration of the move */
+    float MoveDuration{ 0.f };
+
+    /** Delta time of the last move tick — tolerance of FinishDashMove's natural end check */
+    float LastMoveDeltaTime{ 0.f };
+
+    /** LUT value already applied — each frame only moves the difference */
+    float AppliedCurveValue{ 0.f };
+
+    /** LUT of the curve driving the current move, null while not moving */
+    TSharedPtr<const FFSDashCurveLUT> MoveLUT;
+
+    /** Built LUTs per dash curve — dash montages share a handful of curves */
+    TMap<TObjectKey<UCurveFloat>, TSharedRef<const FFSDashCurveLUT>> CurveLUTs;
+
+    /** Moves the owner to the given curve value, in swept sub-steps — stops at the first blocking hit */
+    void AdvanceDashMove(float curveValue);
+
+    /** Drops the current move without applying the rest of it (dash cancelled) */
+    void StopDashMove();
 };
\ No newline at end of file
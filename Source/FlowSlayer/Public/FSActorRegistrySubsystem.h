@@ -0,0 +1,92 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FSActorRegistrySubsystem.generated.h"
+
+class ARunManager;
+class AFSArenaManager;
+class ARewardChest;
+
+/** Broadcasted when the RunManager registers itself — late listeners should also query GetRunManager() */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRunManagerRegistered, ARunManager*);
+
+/** Broadcasted each time an arena registers itself */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnArenaRegistered, AFSArenaManager*);
+
+/** Broadcasted each time a reward chest registers itself */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnRewardChestRegistered, ARewardChest*);
+
+/**
+ * Per-world registry of the gameplay actors other systems need to find.
+ * Actors register themselves on BeginPlay and unregister on EndPlay,
+ * so lookups never scan the actor list.
+ *
+ * Registration order is BeginPlay dispatch order, which follows the level actor order
+ * and is therefore stable for a given map.
+ */
+UCLASS()
+class FLOWSLAYER_API UFSActorRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// ==================== EVENTS ====================
+
+	/** Broadcasted when the RunManager registers */
+	FOnRunManagerRegistered OnRunManagerRegistered;
+
+	/** Broadcasted when an arena registers */
+	FOnArenaRegistered OnArenaRegistered;
+
+	/** Broadcasted when a reward chest registers */
+	FOnRewardChestRegistered OnRewardChestRegistered;
+
+	// ==================== REGISTRATION ====================
+
+	/**
+	 * Registers the RunManager of this world.
+	 * @return false if another RunManager is already registered (caller is a duplicate)
+	 */
+	bool RegisterRunManager(ARunManager* RunManager);
+
+	/** Unregisters the RunManager if it is the registered one */
+	void UnregisterRunManager(ARunManager* RunManager);
+
+	/** Registers an arena — ignored if already registered */
+	void RegisterArena(AFSArenaManager* Arena);
+
+	/** Unregisters an arena */
+	void UnregisterArena(AFSArenaManager* Arena);
+
+	/** Registers a reward chest — ignored if already registered */
+	void RegisterRewardChest(ARewardChest* Chest);
+
+	/** Unregisters a reward chest */
+	void UnregisterRewardChest(ARewardChest* Chest);
+
+	// ==================== QUERIES ====================
+
+	/** Returns the registered RunManager (nullptr if none has begun play yet) */
+	ARunManager* GetRunManager() const { return RunManager; }
+
+	/** Returns every registered arena, in registration order */
+	const TArray<AFSArenaManager*>& GetArenas() const { return Arenas; }
+
+	/** Returns every registered reward chest, in registration order */
+	const TArray<ARewardChest*>& GetRewardChests() const { return RewardChests; }
+
+private:
+
+	/** The single RunManager of this world */
+	UPROPERTY()
+	ARunManager* RunManager{ nullptr };
+
+	/** Registered arenas, in registration order */
+	UPROPERTY()
+	TArray<AFSArenaManager*> Arenas;
+
+	/** Registered reward chests, in registration order */
+	UPROPERTY()
+	TArray<ARewardChest*> RewardChests;
+};
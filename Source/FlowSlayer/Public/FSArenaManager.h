@@ -5,6 +5,9 @@
 #include "ArenaPortal.h"
 #include "RewardChest.h"
 #include "FSEnemy.h"
+#include "FSSpawnDirector.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "FSArenaManager.generated.h"
 
 /** Broadcasted when the arena encounter starts */
@@ -17,8 +20,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnArenaCleared);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnemySpawned, AFSEnemy*, Enemy);
 
 /**
- * Defines a cap escalation threshold.
- * When TotalKills reaches KillThreshold, the max alive enemy count increases by CapIncrease.
+ * Defines a difficulty escalation threshold.
+ * When TotalKills reaches KillThreshold, the spawn director's difficulty target increases by MaxAliveIncrease.
  */
 USTRUCT(BlueprintType)
 struct FCapEscalationStep
@@ -29,18 +32,22 @@ struct FCapEscalationStep
 	UPROPERTY(EditAnywhere, Category = "Escalation")
 	int32 KillThreshold{ 0 };
 
-	/** How much the max alive count increases at this threshold */
+	/** How much the difficulty target increases at this threshold (a DifficultyCost 1 enemy counts as one) */
 	UPROPERTY(EditAnywhere, Category = "Escalation")
 	int32 MaxAliveIncrease{ 1 };
 };
 
 /**
  * Orchestrates an arena encounter across multiple spawn zones.
- * Manages total enemies to spawn, max alive limit, escalation,
- * and arena lifecycle (start/clear).
+ * Manages total enemies to spawn, escalation and arena lifecycle (start/clear).
+ * What spawns, and when, is decided by SpawnDirector from the archetype costs of the resident zone candidates.
  *
  * Place this actor in the level, assign SpawnZones manually in the editor.
  * RunManager calls StartArena() when the player enters this arena.
+ *
+ * Owns the preload manifest of its arena: on BeginPlay (i.e. when its sublevel streams in, one arena ahead)
+ * it streams in the enemy classes of its zones, then what those enemies need, plus PreloadManifest.
+ * Everything is released on EndPlay when the sublevel streams out.
  */
 UCLASS()
 class FLOWSLAYER_API AFSArenaManager : public AActor
@@ -53,6 +60,8 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// ==================== EVENTS ====================
 
 	/** Broadcasted when the arena starts */
@@ -93,10 +102,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Arena")
 	int32 GetRemainingToSpawn() const { return TotalEnemiesToSpawn - TotalSpawned; }
 
-	/** Returns current max alive enemies allowed simultaneously */
+	/** Returns the current difficulty target (in DifficultyCost units) */
 	UFUNCTION(BlueprintCallable, Category = "Arena")
 	int32 GetCurrentMaxAlive() const { return CurrentMaxAlive; }
 
+	/** Returns the live performance / difficulty budget of the spawn director */
+	UFUNCTION(BlueprintCallable, Category = "Arena")
+	FFSSpawnBudgetState GetSpawnBudgetState() const { return SpawnDirector.GetState(); }
+
+	/** Fills OutCandidates with the resident enemy classes of every zone (reset first) */
+	void GatherSpawnCandidates(TArray<FFSSpawnCandidate>& OutCandidates);
+
 	/** Returns the exit portal assigned to this arena — used by RunManager to bind OnPlayerTeleported */
 	AArenaPortal* GetExitPortal() const { return ExitPortal; }
 
@@ -112,27 +128,32 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Arena|Spawning")
 	int32 TotalEnemiesToSpawn{ 30 };
 
-	/** Max enemies alive at the same time when the arena starts */
+	/** Difficulty target when the arena starts — in DifficultyCost units, i.e. basic enemies alive at once */
 	UPROPERTY(EditAnywhere, Category = "Arena|Spawning")
 	int32 InitialMaxAlive{ 5 };
 
-	/** Absolute maximum that MaxAlive can reach through escalation */
+	/** Absolute maximum the difficulty target can reach through escalation */
 	UPROPERTY(EditAnywhere, Category = "Arena|Spawning")
 	int32 MaxAliveLimit{ 15 };
 
+	/** Picks what spawns next within the performance budget, filling toward the difficulty target */
+	UPROPERTY(EditAnywhere, Category = "Arena|Spawning")
+	FFSSpawnDirector SpawnDirector;
+
 	/**
 	 * Ordered escalation steps. Each step defines a kill threshold
-	 * and how much MaxAlive increases when that threshold is reached.
+	 * and how much the difficulty target increases when that threshold is reached.
+	 * Targets, not caps: the director may overshoot by one spawn and always stays within its performance budget.
 	 * Must be sorted by KillThreshold ascending in the editor.
 	 */
 	UPROPERTY(EditAnywhere, Category = "Arena|Escalation")
 	TArray<FCapEscalationStep> EscalationSteps;
 
-	/** Minimum spawn cooldown between each spawn attempt */
+	/** Spawn cooldown while the arena is empty — the cooldown grows toward MaxSpawnCooldown as the target fills */
 	UPROPERTY(EditAnywhere, Category = "Arena|SpawnTiming")
 	float MinSpawnCooldown{ 1.f };
 
-	/** Maximum spawn cooldown between each spawn attempt */
+	/** Spawn cooldown once the difficulty target is reached */
 	UPROPERTY(EditAnywhere, Category = "Arena|SpawnTiming")
 	float MaxSpawnCooldown{ 3.f };
 
@@ -146,12 +167,18 @@ private:
 	UPROPERTY(EditAnywhere, Category = "Arena|Debug")
 	bool bForceActivate{ false };
 
+	/** Extra assets this arena needs resident while it is fought (e.g. set dressing VFX)
+	 * Enemy classes and their montages / VFX are gathered automatically from SpawnZones
+	 */
+	UPROPERTY(EditAnywhere, Category = "Arena|Streaming")
+	TArray<FSoftObjectPath> PreloadManifest;
+
 	// ==================== RUNTIME STATE ====================
 
 	/** Whether the arena encounter is currently running */
 	bool bIsArenaActive{false};
 
-	/** Current max alive enemies (starts at InitialMaxAlive, grows via escalation) */
+	/** Current difficulty target (starts at InitialMaxAlive, grows via escalation) */
 	int32 CurrentMaxAlive{ 0 };
 
 	/** Total enemies spawned so far */
@@ -166,15 +193,33 @@ private:
 	/** Index into EscalationSteps, tracks the next threshold to check */
 	int32 NextEscalationIndex{ 0 };
 
+	/** Candidates of the current spawn attempt — memory kept across attempts */
+	TArray<FFSSpawnCandidate> SpawnCandidates;
+
 	/** Timer handle for the spawn loop */
 	FTimerHandle SpawnTimerHandle;
 
+	/** Keeps PreloadManifest + enemy classes + portal VFX resident */
+	TSharedPtr<FStreamableHandle> ContentPreloadHandle;
+
+	/** Keeps what the enemy classes reference (montages, VFX) resident */
+	TSharedPtr<FStreamableHandle> EnemyDependenciesHandle;
+
 	// ==================== INTERNAL METHODS ====================
 
-	/** Timer callback: attempts to spawn an enemy from a random zone */
+	/** Streams in the arena manifest — first pass (classes + explicit assets) */
+	void RequestContentPreload();
+
+	/** First pass loaded — enemy defaults are readable, streams in their dependencies */
+	void HandleOnContentPreloaded();
+
+	/** Releases both preload handles so the content can be garbage collected */
+	void ReleaseContentPreload();
+
+	/** Timer callback: asks the spawn director for a candidate among the zones and spawns it */
 	void TrySpawnEnemy();
 
-	/** Schedules the next spawn attempt with a random cooldown */
+	/** Schedules the next spawn attempt — paced by the spawn director */
 	void ScheduleNextSpawn();
 
 	/** Callback when a managed enemy dies */
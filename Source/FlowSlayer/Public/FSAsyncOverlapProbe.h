@@ -0,0 +1,59 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+
+/** How old the results of a scene query may be — chosen per call site */
+enum class EFSQueryLatency : uint8
+{
+	/** Synchronous query, blocks the game thread */
+	Immediate,
+
+	/** Results of the async probe issued last frame; falls back to Immediate when the probe does not cover the query */
+	OneFrame
+};
+
+/**
+ * Sphere overlap re-issued every frame through the async trace interface (UWorld::AsyncOverlapByObjectType).
+ * The physics work runs alongside the rest of the game thread frame; results are collected the frame after the request,
+ * so every read is one frame late — only for probes that tolerate it (target acquisition, not hit detection).
+ *
+ * Tick order: Poll, then Request. GetActorsInRadius polls lazily so a consumer running before the owner's tick still sees the latest results.
+ * Game thread only.
+ */
+struct FLOWSLAYER_API FFSAsyncOverlapProbe
+{
+	/** Collects the pending results if the async trace finished */
+	void Poll(UWorld* World);
+
+	/** Issues a new overlap for next frame — a still pending request is dropped */
+	void Request(UWorld* World, const FVector& Center, float Radius, ECollisionChannel ObjectChannel, const AActor* IgnoredActor);
+
+	/**
+	 * Returns the actors of the last results whose collision reaches the given sphere.
+	 * @return FALSE if the results are older than one frame or the probe radius is smaller than Radius — query synchronously instead
+	 */
+	bool GetActorsInRadius(UWorld* World, const FVector& Center, float Radius, TArray<AActor*>& OutActors);
+
+	/** Drops the pending request and the results */
+	void Reset();
+
+private:
+
+	/** Pending async request (invalid once collected) */
+	FTraceHandle PendingHandle;
+
+	/** Frame the pending request was issued */
+	uint64 PendingFrame{ 0 };
+
+	/** Radius of the pending request */
+	float PendingRadius{ 0.f };
+
+	/** Unique actors found by the last collected request */
+	TArray<TWeakObjectPtr<AActor>> Results;
+
+	/** Frame the last collected request was issued — 0 if none */
+	uint64 ResultsFrame{ 0 };
+
+	/** Radius of the last collected request */
+	float ResultsRadius{ 0.f };
+};
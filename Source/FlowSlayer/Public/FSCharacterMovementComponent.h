@@ -0,0 +1,99 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "FSCharacterMovementComponent.generated.h"
+
+class UCurveFloat;
+
+/** Custom movement modes of FlowSlayer characters (MOVE_Custom sub-modes) */
+UENUM(BlueprintType)
+enum class EFSCustomMovementMode : uint8
+{
+	None,
+
+	/** Hang in the air after a launcher / air hit, then drop back into falling — see UFSCharacterMovementComponent */
+	AirJuggle,
+};
+
+/**
+ * Character movement shared by the player and the enemies.
+ *
+ * Adds the air juggle mode (MOVE_Custom + EFSCustomMovementMode::AirJuggle), which replaces the MOVE_Flying / MOVE_Falling
+ * toggles of air stalls and launchers: the character enters it once, re-stalls while juggled only refresh the hang
+ * (no mode switch, no timer), and PhysAirJuggle drops it into falling by itself once the hang is over.
+ *
+ * Two ways to juggle:
+ * - StartAirJuggle(HangTime) — timed hang, code-driven (enemy hit reactions)
+ * - HoldAirJuggle / ReleaseAirJuggle — hang for as long as a notify window is open (air stall window, launcher warp)
+ */
+UCLASS()
+class FLOWSLAYER_API UFSCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	/**
+	 * Enters the air juggle, or refreshes it when already juggling.
+	 * Each refresh before landing hangs shorter (AirJuggleDecay) so a juggle cannot be held forever.
+	 * @param HangTime Hang duration of a fresh juggle, in seconds
+	 */
+	void StartAirJuggle(float HangTime);
+
+	/** Keeps the character hanging until the matching ReleaseAirJuggle — enters the air juggle if needed */
+	void HoldAirJuggle();
+
+	/** Releases a HoldAirJuggle — the juggle ends on the next update once no hold and no hang time are left */
+	void ReleaseAirJuggle();
+
+	UFUNCTION(BlueprintPure, Category = "Air Juggle")
+	bool IsAirJuggling() const { return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(EFSCustomMovementMode::AirJuggle); }
+
+	/** Falling, flying or air juggling — what gameplay means by "in the air" */
+	UFUNCTION(BlueprintPure, Category = "Air Juggle")
+	bool IsAirborne() const { return IsFalling() || IsFlying() || IsAirJuggling(); }
+
+	/** Hits on a juggled character push it without leaving the juggle */
+	virtual bool HandlePendingLaunch() override;
+
+protected:
+
+	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+
+	/** Gravity scale over the hang (X = normalized hang time [0, 1], Y = multiplier of the regular gravity) — null hangs with no gravity */
+	UPROPERTY(EditDefaultsOnly, Category = "Air Juggle")
+	UCurveFloat* AirJuggleGravityCurve{ nullptr };
+
+	/** Exponential damping of the velocity while juggled (1/s) — bleeds the launch / knockback speed into a hang */
+	UPROPERTY(EditDefaultsOnly, Category = "Air Juggle", meta = (ClampMin = "0.0"))
+	float AirJuggleDamping{ 8.f };
+
+	/** Hang time lost per refresh of the same juggle (0.2 = each re-stall hangs 20% shorter than the previous one) */
+	UPROPERTY(EditDefaultsOnly, Category = "Air Juggle", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float AirJuggleDecay{ 0.2f };
+
+	/** Floor of the decayed hang time, as a fraction of the requested one */
+	UPROPERTY(EditDefaultsOnly, Category = "Air Juggle", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float AirJuggleMinHangScale{ 0.3f };
+
+private:
+
+	/** Hang duration of the current juggle (decay applied) */
+	float JuggleHangTime{ 0.f };
+
+	/** Time spent hanging since the last StartAirJuggle */
+	float JuggleElapsed{ 0.f };
+
+	/** StartAirJuggle calls since the character last stood on the ground — drives the decay */
+	int32 JuggleCount{ 0 };
+
+	/** Open HoldAirJuggle windows — the juggle cannot end while > 0 */
+	int32 AirJuggleHolds{ 0 };
+
+	/** Switches to the air juggle mode unless already in it — vertical speed is stalled either way */
+	void EnterAirJuggle();
+
+	/** Hang movement: damped velocity, curve-scaled gravity, sweep, slide, land */
+	void PhysAirJuggle(float deltaTime, int32 Iterations);
+};
@@ -8,10 +8,12 @@
 #include "FSWeapon.h"
 #include "CombatData.h"
 #include "FSDamageable.h"
-#include "UpgradeData.h"
+#include "FSStatsComponent.h"
 #include "HitboxComponent.h"
 #include "HitFeedbackComponent.h"
 #include "Kismet/KismetMathLibrary.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "FSCombatComponent.generated.h"
 
 class USoundBase;
@@ -153,6 +155,8 @@ protected:
 
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Combat")
@@ -182,10 +186,6 @@ public:
 
     void SetLockedOnTargetRef(AActor* lockedOnTarget) { LockedOnTarget = lockedOnTarget; }
 
-    /** Applies upgrade effects that concern the combat system (Damage stat) */
-    UFUNCTION()
-    void HandleOnUpgradeSelected(const FUpgradeData& Upgrade);
-
 private:
 
     /** Player's Weapon reference */
@@ -299,14 +299,14 @@ private:
     UPROPERTY(BlueprintReadOnly, Category = "Combat|Combos", meta = (AllowPrivateAccess = "true"))
     FCombo AerialSlamAttack;
 
-    /** Multiplicative damage scalar applied to all outgoing hits — starts at 1.0, upgraded via Damage upgrades */
-    float DamageMultiplier{ 1.f };
+    /** Damage stat (upgrades + weapon parts) applied to all outgoing hits — cached from the owner's stats component on BeginPlay */
+    const FStatAggregate* DamageStat{ &FStatAggregate::Identity };
 
-    /** Multiplicative scalar applied to all attack cooldown durations — starts at 1.0, upgraded via AttackCooldown upgrades */
-    float AttackCooldownMultiplier{ 1.f };
+    /** Scalar applied to all attack cooldown durations — AttackCooldown stat */
+    const FStatAggregate* AttackCooldownStat{ &FStatAggregate::Identity };
 
-    /** Play rate multiplier applied to all attack montages — starts at 1.0, upgraded via AttackPlayRate upgrades */
-    float AttackPlayRateMultiplier{ 1.f };
+    /** Play rate multiplier applied to all attack montages — AttackPlayRate stat */
+    const FStatAggregate* AttackPlayRateStat{ &FStatAggregate::Identity };
 
     /** Currently active combo (pointer to one of the above combos) */
     FCombo* OngoingCombo{ nullptr };
@@ -319,6 +319,17 @@ private:
     /** Initialize the combo lookup table with all available combos */
     void InitializeComboLookupTable();
 
+    /** Keeps the moveset montages and hit VFX resident for the lifetime of this component */
+    TSharedPtr<FStreamableHandle> CombatContentHandle;
+
+    /** Streams in every combo montage + owned hit VFX
+     * The player moveset does not vary with the weapon tier, so it is all requested at BeginPlay
+     */
+    void RequestCombatContentPreload();
+
+    /** Compiles the hitbox timelines of the streamed-in moveset */
+    void HandleCombatContentLoaded();
+
     /** Initialize all combo attack data (damage, knockback, attack types, chainable attacks)
      * Called in PostInitProperties() after Blueprint montages are loaded
      */
@@ -0,0 +1,170 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FSCrowdSubsystem.generated.h"
+
+class AFSEnemy;
+class AFSEnemyAIController;
+
+/** Per-enemy state of one update pass — one contiguous array, indexed like the roster */
+struct FFSCrowdAgent
+{
+	// ---- Read stage (game thread) ----
+
+	/** World location */
+	FVector Location{ FVector::ZeroVector };
+
+	/** Ground-plane location */
+	FVector2f Location2D{ FVector2f::ZeroVector };
+
+	/** Personal space radius (archetype CrowdRadius) */
+	float Radius{ 0.f };
+
+	/** Input scale at full overlap (archetype CrowdSeparationStrength) */
+	float Strength{ 0.f };
+
+	/** World time of the last hit received (< 0 if never hit) */
+	double LastHitReceivedTime{ -1.0 };
+
+	/** Walking or NavWalking */
+	bool bOnGround{ false };
+
+	bool bAttacking{ false };
+
+	bool bCanAttack{ false };
+
+	/** The controller has no move in progress */
+	bool bMoveIdle{ false };
+
+	bool bMovementReduced{ false };
+
+	// ---- Compute stage (parallel — each agent only writes its own fields below) ----
+
+	/** Whether the apply stage asks the controller to follow the player */
+	bool bFollowPlayer{ false };
+
+	/** Movement LOD wanted for this frame */
+	bool bWantsReducedMovement{ false };
+
+	/** Separation input (fraction of max acceleration) */
+	FVector2f Separation{ FVector2f::ZeroVector };
+};
+
+/** Range of SortedAgents belonging to one grid cell */
+struct FFSCrowdCell
+{
+	int32 Start{ 0 };
+	int32 Count{ 0 };
+};
+
+/**
+ * Roster of the alive enemies of a world, and their per-frame update phase (replaces the AI controller tick):
+ * 1. Read (game thread) — copies what the pass needs from each enemy / controller into the contiguous Agents array,
+ *    then buckets the agents into a uniform grid (cell = largest personal space diameter)
+ * 2. Compute (ParallelFor over Agents) — distance to the player, movement LOD, follow decision,
+ *    separation against the 3x3 neighbouring cells; touches no UObject
+ * 3. Apply (game thread) — the only stage that writes to enemies, controllers and movement components
+ *
+ * Separation keeps capsules out of contact, so the movement sweeps rarely resolve enemy-enemy penetration
+ * and their cost stays flat as the arena fills up.
+ *
+ * Movement LOD: beyond fs.Crowd.LODDistance from the player, walking enemies drop to the distant mover
+ * (AFSEnemy::SetReducedMovement — NavWalking at a lower tick rate, mesh smoothed by AFSEnemy::UpdateMovementSmoothing) and come back to full walking once closer
+ * than LODDistance * lodPromoteRatio, when attacking, or for a while after being hit.
+ *
+ * Enemies register on BeginPlay and leave on death or EndPlay. Toggle with fs.Crowd.Separation / fs.Crowd.MovementLOD.
+ */
+UCLASS()
+class FLOWSLAYER_API UFSCrowdSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Adds an enemy to the roster — ignored if already registered */
+	void RegisterEnemy(AFSEnemy* Enemy);
+
+	/** Removes an enemy from the roster */
+	void UnregisterEnemy(AFSEnemy* Enemy);
+
+	/** Returns the alive enemies (order is not stable — removals swap) */
+	const TArray<AFSEnemy*>& GetEnemies() const { return Enemies; }
+
+	/** Returns how many alive enemies ran the distant mover on the last pass */
+	int32 GetReducedMovementCount() const { return ReducedMovementCount; }
+
+private:
+
+	/** Agents closer than this are pushed apart along a fixed axis instead of their (degenerate) delta */
+	static constexpr float coincidentDistance{ 1.f };
+
+	/** Minimum agents per parallel batch — below it the pass runs inline */
+	static constexpr int32 minBatchSize{ 16 };
+
+	/** Fraction of LODDistance under which a reduced enemy returns to full walking — the gap avoids flickering at the band edge */
+	static constexpr float lodPromoteRatio{ 0.8f };
+
+	/** Seconds an enemy keeps full walking after a hit */
+	static constexpr float lodHitHoldDuration{ 3.f };
+
+	/** Alive enemies — parallel to Agents and Controllers during a pass */
+	UPROPERTY()
+	TArray<AFSEnemy*> Enemies;
+
+	/** Controllers of the current pass, indexed like Enemies (nullptr if not AI controlled) */
+	TArray<AFSEnemyAIController*> Controllers;
+
+	/** Per-frame state, indexed like Enemies */
+	TArray<FFSCrowdAgent> Agents;
+
+	/** Grid cell of each agent */
+	TArray<FIntPoint> AgentCells;
+
+	/** Agent indices grouped by cell */
+	TArray<int32> SortedAgents;
+
+	/** Occupied cells — memory kept across frames */
+	TMap<FIntPoint, FFSCrowdCell> Cells;
+
+	/** Grid cell size of the current pass */
+	float CellSize{ 1.f };
+
+	/** Enemies on the distant mover after the last pass */
+	int32 ReducedMovementCount{ 0 };
+
+	// ---- Pass inputs, fixed for the whole compute stage ----
+
+	FVector PlayerLocation{ FVector::ZeroVector };
+	bool bHasPlayer{ false };
+	bool bSeparationEnabled{ false };
+	bool bMovementLODEnabled{ false };
+	double LODDemoteDistSquared{ 0.0 };
+	double LODPromoteDistSquared{ 0.0 };
+	double Now{ 0.0 };
+	float DeltaSeconds{ 0.f };
+
+	/** Read stage — copies the roster state into Agents */
+	void GatherAgents();
+
+	/** Read stage — buckets Agents into Cells / SortedAgents */
+	void BuildGrid();
+
+	/** Compute stage — ParallelFor over Agents */
+	void ComputeAgents();
+
+	/** Compute stage of one agent */
+	void ComputeAgent(int32 AgentIndex);
+
+	/** Separation of one agent against its 3x3 neighbourhood */
+	FVector2f ComputeAgentSeparation(int32 AgentIndex) const;
+
+	/** Apply stage — writes the decisions back to the enemies (game thread) */
+	void ApplyAgents();
+
+	/** Returns the grid cell of a ground-plane location */
+	FIntPoint GetCell(const FVector2f& Location) const;
+};
@@ -2,53 +2,89 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "FSCharacterMovementComponent.h"
 #include "Components/ShapeComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "DrawDebugHelpers.h"
 #include "HealthComponent.h"
 #include "FSDamageable.h"
 #include "FSFocusable.h"
+#include "FSNotifyContextProvider.h"
 #include "HitFeedbackComponent.h"
 #include "HitboxComponent.h"
 #include "Components/BoxComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Animation/AnimInstance.h"
-#include "Components/WidgetComponent.h"
 #include "CombatData.h"
+#include "FSEnemyArchetype.h"
 #include "FSEnemy.generated.h"
 
 DECLARE_MULTICAST_DELEGATE(FOnProjectileSpawned);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEnemyDeath, AFSEnemy*, enemy);
 
 UCLASS(Abstract)
-class FLOWSLAYER_API AFSEnemy : public ACharacter, public IFSDamageable, public IFSFocusable
+class FLOWSLAYER_API AFSEnemy : public ACharacter, public IFSDamageable, public IFSFocusable, public IFSNotifyContextProvider
 {
     GENERATED_BODY()
 
 public:
 
-    AFSEnemy();
+    /** Swaps the default movement component for UFSCharacterMovementComponent (air juggle mode) */
+    AFSEnemy(const FObjectInitializer& ObjectInitializer);
 
     UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Combat")
     void Attack();
 
     virtual UHealthComponent* GetHealthComponent() override { return HealthComponent; }
 
+    virtual FFSNotifyContext& GetNotifyContext() override { return NotifyContext; }
+
     virtual void DisplayLockedOnWidget(bool bShowWidget) override;
 
     virtual void DisplayHealthBarWidget(bool bShowWidget) override;
 
     virtual void DisplayAllWidgets(bool bShowWidget) override;
 
-    float GetAttackRange() const { return AttackRange; }
+#if WITH_EDITOR
+    /** Reports a missing Archetype when the Blueprint is validated, before it can fail at spawn */
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
+
+    /** Returns the shared tuning of this enemy — never null on a spawned enemy (checked in BeginPlay) */
+    const UFSEnemyArchetype* GetArchetype() const { return Archetype; }
+
+    float GetAttackRange() const { return GetArchetype()->AttackRange; }
     bool IsAttacking() const { return bIsAttacking; }
     bool CanAttack() const { return bCanAttack; }
-    int32 GetXPReward() const { return XPReward; }
-    int32 GetScoreReward() const { return ScoreReward; }
-	float GetWeaponPartDropChance() const { return WeaponPartDropChance; }
+    int32 GetXPReward() const { return GetArchetype()->XPReward; }
+    int32 GetScoreReward() const { return GetArchetype()->ScoreReward; }
+    float GetWeaponPartDropChance() const { return GetArchetype()->WeaponPartDropChance; }
 
     void SetIsAttacking(bool isAttacking) { bIsAttacking = isAttacking; }
 
+    /** Switches between the full walking simulation and the distant mover
+    * Reduced: NavWalking (navmesh-projected, no floor or capsule sweeps against the world) at a lower tick rate
+    * Only a walking enemy can be reduced — driven by UFSCrowdSubsystem
+    */
+    void SetReducedMovement(bool bReduced);
+
+    /** Returns true while the distant mover is active */
+    bool IsMovementReduced() const { return bReducedMovement; }
+
+    /** Hides the steps of the distant mover: when the capsule jumps on a movement tick, the mesh stays on its last
+    * rendered transform and catches up linearly over one movement tick (the CMC does the same for simulated proxies)
+    * Called every frame by UFSCrowdSubsystem, reduced or not — a promoted enemy finishes its catch-up
+    */
+    void UpdateMovementSmoothing(float DeltaTime);
+
+    /** World time of the last hit received (-1 if never hit) */
+    double GetLastHitReceivedTime() const { return LastHitReceivedTime; }
+
+    /** Appends the soft assets an instance of this class needs resident (attack montage, hit VFX)
+    * Called on the class default object by arena preload manifests
+    */
+    virtual void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
     FOnProjectileSpawned OnProjectileSpawned;
 
     UPROPERTY(BlueprintAssignable, Category = "Combat")
@@ -61,6 +97,8 @@ protected:
 
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /* OnDeath (UHealthComponent) handler */
     virtual void HandleOnDeath();
 
@@ -86,38 +124,42 @@ protected:
     /** Called when owning spawned projectile has hit a target */
     void HandleOnFSProjectileHit(AActor* hitActor, const FVector& hitLocation);
 
-    /** Score points added to the total score on each kill of this specific enemy */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Stats")
-    int32 ScoreReward{ 30 };
+    /** Shared tuning (attack, range, rewards) — one asset per enemy kind, never modified at runtime
+    * Required: an enemy without one fails validation in the editor and asserts in BeginPlay
+    */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Archetype")
+    UFSEnemyArchetype* Archetype{ nullptr };
 
-    /** XP points given to the player, on each kill of this specifc ennemy */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Stats|Rewards")
-    int32 XPReward{ 10 };
+    bool bIsAttacking{ false };
 
-    /** Probability [0, 1] that killing an enemy drops a weapon part.
- *  At 0.15, roughly one in seven kills yields a part. Tunable per-arena in the editor. */
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats|Reward", meta = (ClampMin = "0.0", ClampMax = "1.0"))
-    float WeaponPartDropChance{ 0.15f };
-    
-    /** Distance (in meter) between this ennemy and the player in which it'll attack the player */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Stats")
-    float AttackRange{ 150.f };
+    bool bCanAttack{ true };
 
-    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Attack")
-    FAttackData MainAttack;
+    /** True while the distant mover is active */
+    bool bReducedMovement{ false };
 
-    bool bIsAttacking{ false };
+    /** World offset of the mesh from its capsule-driven location, left to catch up */
+    FVector SmoothingLocationOffset{ FVector::ZeroVector };
 
-    bool bCanAttack{ true };
+    /** Yaw of the mesh from its capsule-driven rotation, left to catch up */
+    float SmoothingYawOffset{ 0.f };
+
+    /** Seconds left for the mesh to reach the capsule */
+    float SmoothingTimeRemaining{ 0.f };
+
+    /** Capsule transform on the previous UpdateMovementSmoothing */
+    FVector LastSmoothedLocation{ FVector::ZeroVector };
+    float LastSmoothedYaw{ 0.f };
+
+    /** World time of the last hit received */
+    double LastHitReceivedTime{ -1.0 };
+
+    /** Components and running state read by the anim notifies of this mesh — shared montages keep their state here */
+    FFSNotifyContext NotifyContext;
 
     /** Player Reference */
     UPROPERTY()
     APawn* Player;
 
-    /** Lock-on ui widget indicator when this enemy is locked-on */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UI")
-    UWidgetComponent* LockOnWidget{ nullptr };
-
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Hitbox")
     UHitboxComponent* HitboxComponent;
 
@@ -132,6 +174,9 @@ private:
 
     static constexpr float destroyDelay{ 5.f };
 
+    /** Movement tick interval of the distant mover (10 Hz) — the mesh is smoothed over it, so it only adds 100 ms of visual lag */
+    static constexpr float reducedMovementTickInterval{ 1.f / 10.f };
+
     UFUNCTION()
     void HandleOnMontageEnded(UAnimMontage* Montage, bool bInterrupted);
 
@@ -140,12 +185,9 @@ private:
 
     // === AIRSTALL ===
 
-    UPROPERTY()
-    FTimerHandle AirStallTimer;
-
-    /** Activates airstall for this instance 
-    * Flying movement mode is activated for airStallDuration
-    * then setting back up to falling mode
+    /** Activates airstall for this instance
+    * Enters (or refreshes) the air juggle movement mode for airStallDuration —
+    * the movement component drops back to falling by itself once the hang is over
     */
     void StartAirStall(float airStallDuration);
 };
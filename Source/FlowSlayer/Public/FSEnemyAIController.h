@@ -11,6 +11,7 @@
  * AI Controller for FSEnemy characters.
  * Handles movement toward the player, attack triggering, and rotation.
  * Enemies follow the player until within attack range, then rotate and attack.
+ * The follow decision runs in UFSCrowdSubsystem's update phase — the controller keeps only the engine tick (control rotation).
  */
 UCLASS()
 class FLOWSLAYER_API AFSEnemyAIController : public AAIController
@@ -25,14 +26,14 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void JumpToDestination(FVector Destination);
 
+	/** Moves the enemy toward the player using NavMesh pathfinding — no-op while a move is in progress */
+	void FollowPlayer();
+
 protected:
 
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
 
-	/** Triggers FollowPlayer every tick if the enemy is alive, not attacking, and can attack */
-	virtual void Tick(float DeltaTime) override;
-
 private:
 
 	/** Cached reference to the possessed enemy */
@@ -43,9 +44,6 @@ private:
 	UPROPERTY()
 	APawn* PlayerRef{ nullptr };
 
-	/** Moves the enemy toward the player using NavMesh pathfinding */
-	void FollowPlayer();
-
 	/** Called when the enemy reaches the player's acceptance radius — triggers rotation and attack */
 	void OnMoveToTargetCompleted(FAIRequestID RequestID, const FPathFollowingResult& Result);
 };
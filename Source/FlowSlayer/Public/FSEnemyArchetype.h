@@ -0,0 +1,69 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "CombatData.h"
+#include "FSEnemyArchetype.generated.h"
+
+class AFSEnemy;
+
+/**
+ * Immutable tuning shared by every enemy of one kind (attack, range, rewards, spawn cost).
+ * Loaded once and referenced by pointer — AFSEnemy instances only carry runtime state.
+ *
+ * The spawn director reads the cost fields straight from the asset, without spawning an actor.
+ * Never modify an archetype at runtime: every live enemy of that kind reads from it.
+ */
+UCLASS(BlueprintType)
+class FLOWSLAYER_API UFSEnemyArchetype : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Appends the soft assets an enemy of this archetype needs resident (attack montage) */
+	void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
+	/** Difficulty budget consumed by one alive enemy — 1 for a basic enemy (arena targets are in these units) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Spawn|Cost", meta = (ClampMin = "1"))
+	int32 DifficultyCost{ 1 };
+
+	/** Estimated game thread cost of one alive enemy — AI, movement, hit processing (ms per frame) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Spawn|Cost", meta = (ClampMin = "0.0"))
+	float CpuCostMs{ 0.05f };
+
+	/** Estimated animation cost of one alive enemy — skeleton size, montage and blend complexity (ms per frame) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Spawn|Cost", meta = (ClampMin = "0.0"))
+	float AnimationCostMs{ 0.05f };
+
+	/** Average projectiles fired per second while alive — 0 for melee enemies */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Spawn|Cost", meta = (ClampMin = "0.0"))
+	float ProjectilesPerSecond{ 0.f };
+
+	/** Attack performed when the enemy is in range */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Attack")
+	FAttackData MainAttack;
+
+	/** Distance (in cm) between the enemy and the player in which it'll attack the player */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Attack", meta = (ClampMin = "0.0"))
+	float AttackRange{ 150.f };
+
+	/** Score points added to the total score on each kill */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Rewards")
+	int32 ScoreReward{ 30 };
+
+	/** XP points given to the player on each kill */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Rewards")
+	int32 XPReward{ 10 };
+
+	/** Probability [0, 1] that a kill drops a weapon part — at 0.15, roughly one in seven kills yields a part */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Rewards", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float WeaponPartDropChance{ 0.15f };
+
+	/** Personal space radius — two enemies steer apart while closer than the sum of their radii (keep above the capsule radius) */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Crowd", meta = (ClampMin = "0.0"))
+	float CrowdRadius{ 70.f };
+
+	/** Fraction of the max acceleration used to steer apart at full overlap */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Crowd", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float CrowdSeparationStrength{ 0.6f };
+};
@@ -10,7 +10,7 @@ class FLOWSLAYER_API AFSEnemy_Grunt : public AFSEnemy
 	
 public:
 
-	AFSEnemy_Grunt();
+	AFSEnemy_Grunt(const FObjectInitializer& ObjectInitializer);
 
 protected:
 
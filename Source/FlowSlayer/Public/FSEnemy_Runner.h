@@ -12,7 +12,9 @@ class FLOWSLAYER_API AFSEnemy_Runner : public AFSEnemy
 	
 public:
 
-	AFSEnemy_Runner();
+	AFSEnemy_Runner(const FObjectInitializer& ObjectInitializer);
+
+	virtual void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const override;
 
 protected:
 
@@ -1,7 +1,7 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
-#include "UpgradeData.h"
+#include "FSStatsComponent.h"
 #include "FSFlowComponent.generated.h"
 
 /**
@@ -29,6 +29,10 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FFlowTierChanged, EFlowTier, newTie
  * Flow is gained by landing attacks and decays passively over time when the player stops fighting.
  * Higher flow tiers grant speed, damage bonuses and unlock special attacks.
  * Taking damage reduces flow, except at Max tier where an immunity window protects it briefly.
+ *
+ * The component does not tick: flow is stored as an anchor (value + time) plus a decay start time and rate,
+ * and evaluated on read. Tier crossings caused by decay are scheduled as timers at their exact time,
+ * and FlowChanged is rate-limited to FlowNotifyRate.
  */
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class FLOWSLAYER_API UFSFlowComponent : public UActorComponent
@@ -43,7 +47,7 @@ public:
 	void AddFlow(float Amount);
 
 	/** Removes flow either when the player gets hit
-	* or when the player stops attacking during a specific amount of time
+	* or voluntarily through ConsumeFlow — passive decay is evaluated analytically, not removed through here
 	*/
 	UFUNCTION()
 	void RemoveFlow(float amount);
@@ -60,11 +64,15 @@ public:
 	/** Returns the current flow tier based on the flow ratio. */
 	EFlowTier GetFlowTier() const;
 
+	/** Returns the current flow value, decay included */
+	UFUNCTION(BlueprintPure)
+	float GetCurrentFlow() const;
+
 	/** Returns the current flow as a normalized ratio between 0.0 and 1.0. */
 	UFUNCTION(BlueprintCallable)
 	float GetFlowRatio() const;
 
-	/** Broadcast whenever CurrentFlow changes. */
+	/** Broadcast when CurrentFlow changes — at most FlowNotifyRate times per second. */
 	UPROPERTY(BlueprintAssignable)
 	FFlowChanged FlowChanged;
 
@@ -82,22 +90,18 @@ public:
 	UFUNCTION(BlueprintPure)
 	bool HasEnoughFlow(float flowCost) const;
 
-	/** Applies upgrade effects that concern the flow system (FlowDecayRate stat) */
-	UFUNCTION()
-	void HandleOnUpgradeSelected(const FUpgradeData& Upgrade);
-
 protected:
 
 	virtual void BeginPlay() override;
 
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Maximum flow value. Defines the 100% cap. */
 	UPROPERTY(EditAnywhere, Category = "Flow")
 	float MaxFlow{ 100.f };
 
 	UPROPERTY(EditAnywhere, Category = "Flow | Decay")
-	/** Flow lost per second during passive decay. */
+	/** Base flow lost per second during passive decay — FlowDecayRate stat applies on top. */
 	float DecayRate{ 8.f };
 
 	/** Delay in seconds before passive decay starts after the last successful hit. */
@@ -110,35 +114,85 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Flow | Decay")
 	float ImmunityDuration{ 5.f };
 
+	/** Maximum number of FlowChanged broadcasts per second (UI refresh rate of the flow bar) */
+	UPROPERTY(EditAnywhere, Category = "Flow | UI", meta = (ClampMin = "1.0"))
+	float FlowNotifyRate{ 20.f };
+
 	/** Force flow to be infinite for debugging purposes */
 	UPROPERTY(EditAnywhere, Category = "Flow | Debug")
 	bool bInfiniteFlow{ false };
 
 private:
 
-	/** Current flow value. Clamped between 0 and MaxFlow at all times. */
-	float CurrentFlow{ 0.f };
+	// === Analytic state ===
+
+	/** Flow value at AnchorTime — every explicit change rebases the anchor to "now" */
+	float AnchorFlow{ 0.f };
+
+	/** World time (seconds) at which AnchorFlow was valid */
+	double AnchorTime{ 0.0 };
+
+	/** World time at which passive decay starts — pushed back by hits and by the immunity window */
+	double DecayStartTime{ 0.0 };
+
+	/** World time at which the Max tier immunity ends */
+	double ImmunityEndTime{ 0.0 };
+
+	/** Decay rate in effect since AnchorTime (FlowDecayRate stat applied) — only changes on a rebase */
+	float CurrentDecayRate{ 0.f };
 
 	/** Cached tier for change detection. Updated by OnFlowTierChanged. */
 	EFlowTier CurrentTier{ EFlowTier::None };
 
-	/** Multiplicative scalar applied to all flow rewards gained on hit — starts at 1.0, upgraded via FlowGainPerHit upgrades */
-	float FlowGainMultiplier{ 1.f };
+	/** FlowDecayRate stat — cached from the owner's stats component on BeginPlay */
+	const FStatAggregate* DecayRateStat{ &FStatAggregate::Identity };
 
-	/** Whether passive decay is currently active. Set to true when DecayGraceTimer expires. */
-	bool bIsDecaying{ false };
+	/** FlowGainPerHit stat — scalar applied to all flow rewards gained on hit */
+	const FStatAggregate* FlowGainStat{ &FStatAggregate::Identity };
 
-	/** Started after each successful hit. Triggers passive decay on expiry. */
-	FTimerHandle DecayGraceTimer;
+	// === Scheduled events ===
 
-	/** Active only at Max tier when the player takes a hit.
-	 * Resets if player lands a hit during the window. Applies deferred flow loss on expiry.
-	 */
-	FTimerHandle ImmunityTimer;
+	/** Fires when decay drags the flow below the lower bound of the current tier */
+	FTimerHandle TierCrossingTimer;
 
-	/** Internal callback bound to FlowChanged. Detects tier transitions and broadcasts FlowTierChanged. */
-	UFUNCTION()
-	void OnFlowChanged(float currentFlow, float flowMax);
+	/** Loops at FlowNotifyRate while decaying so the UI follows the bar */
+	FTimerHandle DecayNotifyTimer;
+
+	/** Flushes a FlowChanged broadcast that was held back by the rate limit */
+	FTimerHandle PendingNotifyTimer;
+
+	/** World time of the last FlowChanged broadcast */
+	double LastFlowNotifyTime{ -1.0 };
+
+	/** Returns the current world time in seconds */
+	double GetNow() const;
+
+	/** Evaluates the flow at the given world time from the anchor */
+	float EvaluateFlow(double Time) const;
+
+	/** Returns true while the Max tier immunity window is active */
+	bool IsImmune() const { return GetNow() < ImmunityEndTime; }
+
+	/** Moves the anchor to now, keeping the evaluated flow */
+	void Rebase();
+
+	/** Broadcasts FlowTierChanged if the evaluated tier differs from CurrentTier */
+	void UpdateFlowTier();
+
+	/** (Re)schedules the tier crossing and decay notify timers from the current analytic state */
+	void ScheduleDecayEvents();
+
+	/** Broadcasts FlowChanged now, or defers it if the last broadcast was less than 1 / FlowNotifyRate ago */
+	void NotifyFlowChanged();
+
+	/** Broadcasts FlowChanged with the evaluated flow */
+	void BroadcastFlowChanged();
+
+	/** Called after every explicit flow change — tier check, event rescheduling, UI notification */
+	void HandleFlowStateChanged();
+
+	/** Bound to UFSStatsComponent::OnStatChanged — rebases on FlowDecayRate changes */
+	void HandleOnStatChanged(EUpgradeStat Stat);
 
 	/** Internal callback bound to FlowTierChanged. Updates the cached CurrentTier. */
 	UFUNCTION()
@@ -0,0 +1,166 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "FSFlowComponent.h"
+#include "UpgradeData.h"
+#include "FSHUDModel.generated.h"
+
+class UHealthComponent;
+class UFSCombatComponent;
+class UProgressionComponent;
+class UFSStatsComponent;
+class ARunManager;
+
+/** HUD regions tracked by the model — each one is a bit of the dirty mask */
+UENUM(BlueprintType)
+enum class EFSHUDField : uint8
+{
+	Health,
+	Flow,
+	Combo,
+	Progression,
+	Score,
+
+	Count UMETA(Hidden)
+};
+
+/** Values displayed by the HUD, as of the last flush */
+USTRUCT(BlueprintType)
+struct FFSHUDSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Health")
+	float Health{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Health")
+	float MaxHealth{ 1.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Flow")
+	float Flow{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Flow")
+	float FlowRatio{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Flow")
+	EFlowTier FlowTier{ EFlowTier::None };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Combo")
+	bool bComboActive{ false };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Combo")
+	int32 ComboCount{ 0 };
+
+	/** Remaining combo window in [0, 1] — refreshed on each flush while the combo is active */
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Combo")
+	float ComboTimeRatio{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Progression")
+	int32 Level{ 1 };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Progression")
+	int32 XP{ 0 };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Progression")
+	float XPRatio{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "HUD|Score")
+	int32 Score{ 0 };
+};
+
+/**
+ * Aggregates every value the HUD shows and marks the changed fields dirty.
+ * Gameplay events only write here — nothing reaches UMG until UFSHUDWidget consumes the dirty mask,
+ * at most once per frame (or at its FlushRate), so a burst of combo hits costs one widget update.
+ *
+ * Continuous values (flow decay, combo window) are polled on consume instead of being pushed every tick.
+ * Owned by AFlowSlayerCharacter.
+ */
+UCLASS(BlueprintType)
+class FLOWSLAYER_API UFSHUDModel : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Resolves the player's components, binds their events and fills the snapshot — every field starts dirty */
+	void Initialize(APawn* Player);
+
+	/** Refreshes the polled fields, then returns the dirty mask (bit = EFSHUDField) and clears it */
+	int32 ConsumeDirtyFields();
+
+	/** Returns the values as of the last consume */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	FFSHUDSnapshot GetSnapshot() const { return Snapshot; }
+
+	/** Returns true if the given field is set in a dirty mask */
+	UFUNCTION(BlueprintPure, Category = "HUD")
+	static bool IsFieldDirty(int32 DirtyFields, EFSHUDField Field) { return (DirtyFields & FieldBit(Field)) != 0; }
+
+	/** Returns the dirty mask bit of a field */
+	static constexpr int32 FieldBit(EFSHUDField Field) { return 1 << static_cast<int32>(Field); }
+
+private:
+
+	/** Current values */
+	FFSHUDSnapshot Snapshot;
+
+	/** Fields changed since the last consume */
+	int32 DirtyFields{ 0 };
+
+	/** Sources, resolved on Initialize */
+	UPROPERTY()
+	UHealthComponent* HealthComponent{ nullptr };
+
+	UPROPERTY()
+	UFSFlowComponent* FlowComponent{ nullptr };
+
+	UPROPERTY()
+	UFSCombatComponent* CombatComponent{ nullptr };
+
+	UPROPERTY()
+	UProgressionComponent* ProgressionComponent{ nullptr };
+
+	/** Marks a field dirty */
+	void MarkDirty(EFSHUDField Field) { DirtyFields |= FieldBit(Field); }
+
+	/** Reads flow and combo window from their components — marks them dirty only if they moved */
+	void RefreshPolledFields();
+
+	/** Re-reads health from the component */
+	void RefreshHealth();
+
+	/** Re-reads level / XP from the component */
+	void RefreshProgression();
+
+	/** Binds the score once the RunManager is known */
+	void BindRunManager(ARunManager* RunManager);
+
+	// ==================== EVENT HANDLERS ====================
+
+	UFUNCTION()
+	void HandleOnDamageReceived(AActor* instigator, float damageAmount, float currentHealth, float maxHealth);
+
+	UFUNCTION()
+	void HandleOnHeal();
+
+	void HandleOnStatChanged(EUpgradeStat Stat);
+
+	UFUNCTION()
+	void HandleOnComboCounterStarted();
+
+	UFUNCTION()
+	void HandleOnComboCountChanged(int32 HitCount);
+
+	UFUNCTION()
+	void HandleOnComboCounterEnded();
+
+	UFUNCTION()
+	void HandleOnXPGained(int32 Amount, int32 NewTotal);
+
+	UFUNCTION()
+	void HandleOnLevelUp(int32 NewLevel);
+
+	UFUNCTION()
+	void HandleOnScoreChanged(int32 NewScore);
+};
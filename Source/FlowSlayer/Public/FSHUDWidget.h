@@ -0,0 +1,71 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "FSHUDModel.h"
+#include "FSHUDWidget.generated.h"
+
+class URetainerBox;
+
+/**
+ * Base class of the main HUD — pulls UFSHUDModel instead of binding every gameplay delegate.
+ * At most once per frame (or FlushRate times per second), consumes the model's dirty mask and
+ * calls OnHUDFlushed once with the snapshot; Blueprint only updates the regions flagged in the mask.
+ *
+ * Each region can be wrapped in a RetainerBox (HealthRegion, FlowRegion, ComboRegion, ProgressionRegion — all optional):
+ * a region is only re-rendered when one of its fields was flushed, unchanged regions keep their cached texture.
+ * Avoid property bindings inside regions — they are polled every frame and defeat the invalidation.
+ */
+UCLASS(Abstract)
+class FLOWSLAYER_API UFSHUDWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Injects the model — called by AFlowSlayerCharacter right after creating the HUD */
+	void SetHUDModel(UFSHUDModel* InHUDModel);
+
+protected:
+
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+	/**
+	 * Called once per flush with the fields that changed since the previous one.
+	 * Use UFSHUDModel::IsFieldDirty to skip the unchanged regions.
+	 */
+	UFUNCTION(BlueprintImplementableEvent, Category = "HUD")
+	void OnHUDFlushed(const FFSHUDSnapshot& Snapshot, int32 DirtyFields);
+
+	/** Maximum flushes per second — 0 flushes every frame that has a change */
+	UPROPERTY(EditDefaultsOnly, Category = "HUD", meta = (ClampMin = "0.0"))
+	float FlushRate{ 0.f };
+
+	/** Optional retainer regions — re-rendered only when their fields are flushed */
+	UPROPERTY(meta = (BindWidgetOptional))
+	URetainerBox* HealthRegion{ nullptr };
+
+	UPROPERTY(meta = (BindWidgetOptional))
+	URetainerBox* FlowRegion{ nullptr };
+
+	UPROPERTY(meta = (BindWidgetOptional))
+	URetainerBox* ComboRegion{ nullptr };
+
+	/** Level, XP and score */
+	UPROPERTY(meta = (BindWidgetOptional))
+	URetainerBox* ProgressionRegion{ nullptr };
+
+	/** Model the HUD reads from */
+	UPROPERTY(BlueprintReadOnly, Category = "HUD")
+	UFSHUDModel* HUDModel{ nullptr };
+
+private:
+
+	/** Real time of the last flush */
+	double LastFlushTime{ 0.0 };
+
+	/** Consumes the model and forwards the changes to Blueprint and the retainer regions */
+	void Flush();
+
+	/** Returns the retainer region displaying the given field (nullptr if not wrapped) */
+	URetainerBox* GetRegion(EFSHUDField Field) const;
+};
@@ -0,0 +1,65 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "HitboxComponent.h"
+#include "FSHitboxTimelineSubsystem.generated.h"
+
+class UAnimMontage;
+
+/** One active frame window of a montage, in montage time */
+USTRUCT(BlueprintType)
+struct FFSHitboxWindow
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Hitbox")
+	float StartTime{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "Hitbox")
+	float EndTime{ 0.f };
+
+	UPROPERTY(BlueprintReadOnly, Category = "Hitbox")
+	FHitboxProfile Profile;
+};
+
+/** Every hitbox window of a montage, sorted by StartTime */
+USTRUCT(BlueprintType)
+struct FFSHitboxTimeline
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Hitbox")
+	TArray<FFSHitboxWindow> Windows;
+
+	bool IsEmpty() const { return Windows.IsEmpty(); }
+
+	/** Extracts the UAnimNotifyState_Hitbox windows of a montage */
+	static FFSHitboxTimeline Compile(const UAnimMontage* Montage);
+};
+
+/**
+ * Compiles and caches the hitbox timeline of each attack montage.
+ * UAnimNotifyState_Hitbox is authoring data only: a montage is compiled once (on first play, or when its owner
+ * finished streaming it in) and UHitboxComponent evaluates the timeline against the montage position,
+ * without notify dispatch nor component lookups.
+ *
+ * Timelines are shared and immutable once compiled — tools can read them through ForEachTimeline.
+ */
+UCLASS()
+class FLOWSLAYER_API UFSHitboxTimelineSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Returns the timeline of a montage, compiled on the first request — never null */
+	TSharedRef<const FFSHitboxTimeline> GetTimeline(const UAnimMontage* Montage);
+
+	/** Calls Visitor for each compiled montage */
+	void ForEachTimeline(TFunctionRef<void(const UAnimMontage* Montage, const FFSHitboxTimeline& Timeline)> Visitor) const;
+
+private:
+
+	/** Compiled timelines per montage */
+	TMap<TObjectKey<UAnimMontage>, TSharedRef<const FFSHitboxTimeline>> Timelines;
+};
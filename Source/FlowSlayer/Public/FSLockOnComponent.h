@@ -8,6 +8,7 @@
 #include "FSFocusable.h"
 #include "FSDamageable.h"
 #include "FSCombatComponent.h"
+#include "FSAsyncOverlapProbe.h"
 #include "FSLockOnComponent.generated.h"
 
 /** Delegate when lock-on is engaged */
@@ -58,6 +59,20 @@ public:
 	/** Stop the lock-on */
 	void DisengageLockOn();
 
+	/** Finds the unique pawns overlapping a sphere around the player (player excluded)
+	* @param latency OneFrame reads the async target probe (last frame's positions) when it covers the radius, Immediate always queries synchronously
+	* @return FALSE if no pawn was found
+	*/
+	bool FindPawnsInRadius(float radius, TArray<AActor*>& outActors, EFSQueryLatency latency);
+
+	/** Internal method called by delegate OnAttackingStarted in UFSCombatComponent — opens the target probe window */
+	UFUNCTION()
+	void OnAttackingStarted();
+
+	/** Internal method called by delegate OnAttackingEnded in UFSCombatComponent — closes the target probe window */
+	UFUNCTION()
+	void OnAttackingEnded();
+
 	/** Delay in which the player can switch lock-on in-between targets */
 	const float targetSwitchDelay{ 0.65f };
 
@@ -95,9 +110,22 @@ private:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Lock-On System", meta = (AllowPrivateAccess = "true"))
 	float LockOnDetectionRadius{ 2000.f };
 
+	/** If true, an async overlap of LockOnDetectionRadius is issued every frame while locked on or attacking,
+	* so target switches and motion warp searches read it instead of blocking the game thread.
+	* Outside those windows the component does not tick and searches query synchronously.
+	*/
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Lock-On System", meta = (AllowPrivateAccess = "true"))
+	bool bAsyncTargetProbe{ true };
+
+	/** Pawns around the player, one frame late */
+	FFSAsyncOverlapProbe TargetProbe;
+
 	/** TRUE if player is locked-on to a target */
 	bool bIsLockedOnEngaged{ false };
 
+	/** TRUE between OnAttackingStarted and OnAttackingEnded — motion warp searches may read the probe */
+	bool bAttackWindowOpen{ false };
+
 	/** Timer responsible for the lock-on delay in-between targets */
 	UPROPERTY()
 	FTimerHandle delaySwitchLockOnTimer;
@@ -148,25 +176,28 @@ private:
 	/** Assigns CurrentLockedOnTarget, CachedDamageableLockOnTarget and CachedFocusableTarget */
 	void SetCurrentTarget(AActor* newTarget);
 
+	/** Ticks only while locked on or while the target probe is needed — drops the probe results otherwise */
+	void RefreshTickEnabled();
+
 	/** Configures player movement and input mode for lock-on or free movement */
 	void SetPlayerLockOnMovementMode(bool bLockOnActive);
 
-	/** Populates TargetsInLockOnRadius with valid targets from the hit results */
-	void CollectValidTargets(const TArray<FHitResult>& hits);
+	/** Populates TargetsInLockOnRadius with valid targets from the found actors */
+	void CollectValidTargets(const TArray<AActor*>& actors);
 
 	/** Scores and returns the best target from TargetsInLockOnRadius based on camera alignment */
 	AActor* FindBestScoredTarget(const FVector& cameraForward) const;
 
 	/** Returns the best target in the given horizontal direction relative to the camera */
-	AActor* FindBestTargetInDirection(const TArray<FHitResult>& hits, bool bLookingRight) const;
+	AActor* FindBestTargetInDirection(const TArray<AActor*>& actors, bool bLookingRight) const;
 
 	/** Switches to the nearest valid target regardless of direction.
 	 * @return The new locked-on target, or nullptr if no valid target was found
 	 */
 	AActor* SwitchToNearestTarget();
 
-	/** Sphere trace to find all pawns in lock-on radius */
-	bool FindTargetsInRadius(TArray<FHitResult>& outHits);
+	/** Finds all pawns in lock-on radius */
+	bool FindTargetsInRadius(TArray<AActor*>& outActors, EFSQueryLatency latency);
 
 	/** Hides widgets of the previous target based on its health state */
 	void HidePreviousTargetWidgets();
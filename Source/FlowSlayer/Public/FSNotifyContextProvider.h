@@ -0,0 +1,94 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "FSNotifyContextProvider.generated.h"
+
+class ACharacter;
+class AFlowSlayerCharacter;
+class UAnimNotifyState;
+class UDashComponent;
+class UFSCharacterMovementComponent;
+class UFSCombatComponent;
+class UFSLockOnComponent;
+class UMotionWarpingComponent;
+class USkeletalMeshComponent;
+
+/** Running state of one notify state on one mesh — derive one per notify class that keeps state between NotifyBegin and NotifyEnd */
+struct FFSNotifyInstanceData
+{
+	virtual ~FFSNotifyInstanceData() = default;
+};
+
+/**
+ * What anim notifies need from the mesh owner, resolved once when it begins play.
+ * Notify objects are shared by every mesh playing the same montage: they read components from here instead of
+ * searching the owner, and keep their per-play state in the instance data instead of in their own members.
+ *
+ * Pointers are null when the owner has no such component (enemies have no combat, dash nor lock-on component).
+ */
+struct FLOWSLAYER_API FFSNotifyContext
+{
+	ACharacter* Character{ nullptr };
+	UFSCharacterMovementComponent* Movement{ nullptr };
+	UFSCombatComponent* Combat{ nullptr };
+	UDashComponent* Dash{ nullptr };
+	UFSLockOnComponent* LockOn{ nullptr };
+	UMotionWarpingComponent* MotionWarping{ nullptr };
+
+	/** Set when the owner is the player character */
+	AFlowSlayerCharacter* Player{ nullptr };
+
+	/** Resolves every pointer from the owner's components — called once from the owner's BeginPlay */
+	void Initialize(ACharacter* InCharacter);
+
+	/** Returns the context of the mesh owner, nullptr if it does not implement IFSNotifyContextProvider (e.g. editor preview) */
+	static FFSNotifyContext* Get(const USkeletalMeshComponent* MeshComp);
+
+	/** Creates fresh instance data for a notify on this mesh — replaces any left over from an interrupted play */
+	template<typename TData>
+	TData& BeginInstance(const UAnimNotifyState* Notify)
+	{
+		TUniquePtr<FFSNotifyInstanceData>& data{ Instances.FindOrAdd(Notify) };
+		data = MakeUnique<TData>();
+		return static_cast<TData&>(*data);
+	}
+
+	/** Returns the instance data of a notify on this mesh, nullptr if it did not begin here */
+	template<typename TData>
+	const TData* FindInstance(const UAnimNotifyState* Notify) const
+	{
+		const TUniquePtr<FFSNotifyInstanceData>* data{ Instances.Find(Notify) };
+		return data ? static_cast<const TData*>(data->Get()) : nullptr;
+	}
+
+	/** Mutable overload — notifies updating their running state need a non-const context */
+	template<typename TData>
+	TData* FindInstance(const UAnimNotifyState* Notify)
+	{
+		return const_cast<TData*>(static_cast<const FFSNotifyContext*>(this)->FindInstance<TData>(Notify));
+	}
+
+	/** Releases the instance data of a notify on this mesh */
+	void EndInstance(const UAnimNotifyState* Notify) { Instances.Remove(Notify); }
+
+private:
+
+	/** Running notify states of this mesh — a notify's data is only ever read back with its own type */
+	TMap<const UAnimNotifyState*, TUniquePtr<FFSNotifyInstanceData>> Instances;
+};
+
+UINTERFACE(MinimalAPI)
+class UFSNotifyContextProvider : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/** Implemented by every character playing FlowSlayer notifies — exposes its pre-resolved notify context */
+class FLOWSLAYER_API IFSNotifyContextProvider
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual FFSNotifyContext& GetNotifyContext() = 0;
+};
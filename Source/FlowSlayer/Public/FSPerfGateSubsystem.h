@@ -0,0 +1,212 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatData.h"
+#include "FSPerfGateSubsystem.generated.h"
+
+class UFSCombatComponent;
+class FJsonObject;
+
+/** Metrics sampled once per frame by the perf gate */
+enum class EFSPerfMetric : uint8
+{
+	GameThreadMs,
+	Allocations,
+	SceneQueries,
+	TimersCreated,
+	ReducedMovementEnemies,
+
+	Count
+};
+
+/** One scripted scenario of Config/FlowSlayerPerfBudgets.json */
+struct FFSPerfScenario
+{
+	/** Frames played before sampling starts — lets streaming, preloads and the first spawns settle */
+	int32 WarmupFrames{ 120 };
+
+	/** Frames sampled once the warmup is over */
+	int32 SampleFrames{ 600 };
+
+	/** Whether the first registered arena is started at the beginning of the scenario */
+	bool bStartArena{ false };
+
+	/** Seconds between two scripted attack inputs */
+	float AttackInterval{ 0.4f };
+
+	/** Attack inputs replayed in a loop on the player's UFSCombatComponent */
+	TArray<EAttackType> AttackScript;
+
+	/** Soak: enemies spawned through the first arena's zones (arena itself not started), player made invincible — 0 for none */
+	int32 SoakEnemyCount{ 0 };
+
+	/** Console variables set before the first frame — lets two scenarios A/B the same content */
+	TMap<FString, FString> ConsoleVariables;
+
+	/** p95 budget per metric — a missing entry disables the check */
+	TMap<EFSPerfMetric, double> Budgets;
+
+	/** Scenario this one is A/B compared against — its report must already exist (run it first) */
+	FString Baseline;
+
+	/** Max p95 delta (this scenario - Baseline) per metric — negative requires a saving of at least that much */
+	TMap<EFSPerfMetric, double> DeltaBudgets;
+
+	/** Map opened by the FlowSlayer.PerfGate.Scenario automation test — a command line run plays the map it was given */
+	FString Map;
+
+	/** Budgets not yet set from a recorded run — an overrun is reported as a warning and does not fail the gate */
+	bool bProvisional{ false };
+};
+
+/**
+ * Development-only performance regression gate.
+ * Created only when the command line carries -FSPerfGate=<Scenario> (never in Shipping), e.g.:
+ *   FlowSlayer.uproject <Map> -game -nullrhi -unattended -FSPerfGate=ArenaWave
+ *
+ * Replays the scenario's attack script on the player's UFSCombatComponent (which drives UHitboxComponent
+ * through the montage notifies), optionally starts an AFSArenaManager or spawns a soak population, samples
+ * FFlowSlayerFrameCounters, game-thread time and allocations every frame, then compares the p95 of each metric
+ * to the checked-in budgets. Scenarios may set console variables first, so two of them can A/B one feature
+ * (e.g. CrowdSoak vs CrowdSoakFullMovement for the enemy movement LOD): a scenario naming a Baseline reads
+ * that scenario's report and reports, and optionally budgets, the p95 delta between the two runs.
+ *
+ * The report is written to Saved/PerfGate/<Scenario>.json (or -FSPerfGateOut=<path>; the Baseline report is read from
+ * its default path or -FSPerfGateBaseline=<path>) and the process exits
+ * with code 1 when a budget is exceeded, 2 when the scenario could not run.
+ * Each budgeted metric also gets a SuggestedBudget (measured p95 + headroom) to copy into the budgets file when recording them.
+ *
+ * The FlowSlayer.PerfGate.Scenario automation test runs the same scenarios in-process through SetAutomationScenario:
+ * the gate then keeps the process alive and exposes its result instead of exiting.
+ */
+UCLASS()
+class FLOWSLAYER_API UFSPerfGateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	/** Reads the "Scenarios" object of Config/FlowSlayerPerfBudgets.json — null (logged) if missing or malformed */
+	static TSharedPtr<FJsonObject> LoadScenarios();
+
+	/** Parses one entry of the "Scenarios" object — returns false (logged) if missing or malformed */
+	static bool ParseScenario(const FJsonObject& Scenarios, const FString& InScenarioName, FFSPerfScenario& OutScenario);
+
+	/** Returns the p-th percentile of an unsorted sample set (0 if empty) */
+	static float ComputePercentile(TArray<float> Values, float Percentile);
+
+	/** Returns the JSON key of a metric */
+	static const TCHAR* GetMetricName(EFSPerfMetric Metric);
+
+	/** Parses a metric name -> value object — returns false (logged) on an unknown metric */
+	static bool ParseMetricBudgets(const FJsonObject& Budgets, const FString& InScenarioName, TMap<EFSPerfMetric, double>& OutBudgets);
+
+	// ==================== AUTOMATION ====================
+
+	/** Runs this scenario in the next game worlds instead of -FSPerfGate=, without exiting when it ends — empty to stop */
+	static void SetAutomationScenario(const FString& InScenarioName) { AutomationScenarioName = InScenarioName; }
+
+	/** Returns the scenario run in this world */
+	const FString& GetScenarioName() const { return ScenarioName; }
+
+	/** True once the report is written, or the scenario could not run */
+	bool IsFinished() const { return bFinished; }
+
+	/** Exit code of the finished scenario — 0 passed, 1 budget exceeded, 2 scenario error */
+	uint8 GetResultCode() const { return ResultCode; }
+
+	/** Budgets (metric names, "Delta" suffix for a baseline delta) exceeded by the finished scenario */
+	const TArray<FString>& GetExceededBudgets() const { return ExceededBudgets; }
+
+private:
+
+	// ==================== SCENARIO ====================
+
+	/** Scenario name from -FSPerfGate= or SetAutomationScenario */
+	FString ScenarioName;
+
+	/** Scenario requested by the automation test — takes over -FSPerfGate= and disables the exit */
+	static FString AutomationScenarioName;
+
+	/** Scenario loaded from the budgets file */
+	FFSPerfScenario Scenario;
+
+	/** False until OnWorldBeginPlay loaded a valid scenario, and again once the report is written */
+	bool bRunning{ false };
+
+	/** Frames played since the scenario started (warmup included) */
+	int32 FrameIndex{ 0 };
+
+	/** Player's combat component — resolved lazily, the pawn may not exist on the first frames */
+	UPROPERTY()
+	UFSCombatComponent* CombatComponent{ nullptr };
+
+	/** True once the arena of the scenario was started */
+	bool bArenaStarted{ false };
+
+	/** Seconds accumulated toward the next scripted attack */
+	float AttackAccumulator{ 0.f };
+
+	/** Next entry of Scenario.AttackScript */
+	int32 AttackScriptIndex{ 0 };
+
+	/** Soak enemies spawned so far */
+	int32 SoakSpawned{ 0 };
+
+	/** Feeds the attack script and starts the arena when requested */
+	void DriveScenario(float DeltaTime);
+
+	/** Spawns the soak population once the arena content is resident — a few per frame until SoakEnemyCount */
+	void SpawnSoakEnemies();
+
+	/** Applies Scenario.ConsoleVariables — returns false (logged) if one does not exist */
+	bool ApplyConsoleVariables() const;
+
+	/** p95 of each metric measured by the Baseline scenario's last run */
+	TMap<EFSPerfMetric, double> BaselineMeasured;
+
+	/** Reads the Baseline scenario's report into BaselineMeasured — returns false (logged) if missing or malformed */
+	bool LoadBaselineReport();
+
+	/** Returns the report path of a scenario — Saved/PerfGate/<Scenario>.json */
+	static FString GetDefaultReportPath(const FString& InScenarioName);
+
+	// ==================== SAMPLING ====================
+
+	/** One value per sampled frame, per metric */
+	TArray<float> Samples[static_cast<int32>(EFSPerfMetric::Count)];
+
+	/** Process-wide malloc call count on the previous frame */
+	uint64 LastMallocCalls{ 0 };
+
+	/** Reads the previous frame's metrics, resets the frame counters */
+	void SampleFrame();
+
+	/** Returns the total number of malloc calls so far (0 when the allocator does not count them) */
+	static uint64 GetMallocCalls();
+
+	// ==================== REPORT ====================
+
+	/** Compares the samples to the budgets, writes the JSON report and requests exit */
+	void FinishScenario();
+
+	/** True once the scenario ended */
+	bool bFinished{ false };
+
+	/** Exit code of the finished scenario */
+	uint8 ResultCode{ 0 };
+
+	/** Budgets exceeded by the finished scenario */
+	TArray<FString> ExceededBudgets;
+
+	/** Stops the gate with the given code — requests exit unless run by the automation test */
+	void RequestExit(uint8 ReturnCode);
+};
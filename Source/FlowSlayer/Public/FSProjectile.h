@@ -31,22 +31,25 @@ public:
     */
     FOnFSProjectileHit OnFSProjectileHit;
 
+    /** Appends the soft assets this projectile needs resident (trail + hit VFX) — called on the CDO by preload manifests */
+    void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
 protected:
 
     virtual void BeginPlay() override;
 
     // === VFX ===
 
-    /** Trail Particules VFX */
+    /** Trail Particules VFX — no trail if not resident when the projectile spawns */
     UPROPERTY(EditDefaultsOnly, Category = "VFX")
-    UNiagaraSystem* trailParticules;
+    TSoftObjectPtr<UNiagaraSystem> trailParticules;
 
     UPROPERTY()
     UNiagaraComponent* TrailComponent;
 
-    /** Hit Particules VFX */
+    /** Hit Particules VFX — skipped if the picked system is not resident */
     UPROPERTY(EditDefaultsOnly, Category = "VFX")
-    TArray<UNiagaraSystem*> hitParticlesSystemArray;
+    TArray<TSoftObjectPtr<UNiagaraSystem>> hitParticlesSystemArray;
 
     UPROPERTY(EditDefaultsOnly, Category = "Debug")
     bool DebugLines{ false };
@@ -0,0 +1,118 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "FSSpawnDirector.generated.h"
+
+class AAFSSpawnZone;
+class UFSEnemyArchetype;
+
+/** A resident enemy class a zone can spawn right now, with the archetype it was tuned with */
+struct FFSSpawnCandidate
+{
+	AAFSSpawnZone* Zone{ nullptr };
+	UClass* EnemyClass{ nullptr };
+	const UFSEnemyArchetype* Archetype{ nullptr };
+};
+
+/** Live budget state of a spawn director — read it to profile an arena (also published to "stat FlowSlayer" and Insights) */
+USTRUCT(BlueprintType)
+struct FFSSpawnBudgetState
+{
+	GENERATED_BODY()
+
+	/** Estimated game thread cost of the alive enemies (ms per frame) */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Performance")
+	float FrameCostMs{ 0.f };
+
+	/** Ceiling FrameCostMs never exceeds */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Performance")
+	float FrameBudgetMs{ 0.f };
+
+	/** Measured game thread time, smoothed over the spawn attempts (ms) */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Performance")
+	float MeasuredGameThreadMs{ 0.f };
+
+	/** Sum of the DifficultyCost of the alive enemies */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Difficulty")
+	int32 Difficulty{ 0 };
+
+	/** Difficulty the director fills toward — raised by the arena escalation steps */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Difficulty")
+	int32 DifficultyTarget{ 0 };
+
+	/** Spawn attempts skipped because the difficulty target was already reached */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Difficulty")
+	int32 TargetDeferrals{ 0 };
+
+	/** Spawn attempts skipped because no candidate fit the performance budget */
+	UPROPERTY(BlueprintReadOnly, Category = "Spawn|Performance")
+	int32 PerfDeferrals{ 0 };
+};
+
+/**
+ * Picks what an arena spawns next from two budgets at once:
+ * - Performance (hard): the estimated frame cost of the alive enemies stays under FrameBudgetMs,
+ *   and nothing spawns while the measured game thread time is over GameThreadBudgetMs
+ * - Difficulty (target): the director fills toward DifficultyTarget and may overshoot it by one spawn
+ *   rather than stall when only expensive archetypes remain
+ *
+ * Costs come from UFSEnemyArchetype — candidates are compared without spawning anything.
+ * Owned by AFSArenaManager, game thread only.
+ */
+USTRUCT(BlueprintType)
+struct FLOWSLAYER_API FFSSpawnDirector
+{
+	GENERATED_BODY()
+
+	/** Estimated game thread budget of the whole arena's enemies (ms per frame) */
+	UPROPERTY(EditAnywhere, Category = "Director|Performance", meta = (ClampMin = "0.0"))
+	float FrameBudgetMs{ 2.f };
+
+	/** Cost attributed to each projectile per second of an archetype's fire rate (ms per frame) */
+	UPROPERTY(EditAnywhere, Category = "Director|Performance", meta = (ClampMin = "0.0"))
+	float ProjectileCostMs{ 0.05f };
+
+	/** Spawning holds while the smoothed game thread time is above this (ms) — 0 disables the measurement */
+	UPROPERTY(EditAnywhere, Category = "Director|Performance", meta = (ClampMin = "0.0"))
+	float GameThreadBudgetMs{ 0.f };
+
+	/** Clears the alive budget and sets the first difficulty target — called when the arena starts */
+	void Reset(int32 InDifficultyTarget);
+
+	/** Moves the difficulty target — called by the arena escalation */
+	void SetDifficultyTarget(int32 InDifficultyTarget);
+
+	/**
+	 * Returns the candidate to spawn, or nullptr to defer this attempt (target reached, over budget, nothing resident).
+	 * Candidates whose archetype fits the remaining difficulty are picked uniformly;
+	 * if none fits, the cheapest one within the performance budget is picked.
+	 */
+	const FFSSpawnCandidate* PickCandidate(TConstArrayView<FFSSpawnCandidate> Candidates);
+
+	/** Adds a spawned enemy's costs to the alive budget */
+	void NotifySpawned(const UFSEnemyArchetype& Archetype);
+
+	/** Removes a dead enemy's costs from the alive budget */
+	void NotifyDespawned(const UFSEnemyArchetype& Archetype);
+
+	/** Returns the delay before the next attempt — short while far below the target, long once it is filled */
+	float GetNextSpawnDelay(float MinDelay, float MaxDelay) const;
+
+	/** Returns the live budget state */
+	const FFSSpawnBudgetState& GetState() const { return State; }
+
+	/** Estimated per-frame cost of one alive enemy of this archetype (ms) */
+	float GetFrameCostMs(const UFSEnemyArchetype& Archetype) const;
+
+private:
+
+	/** Smoothing factor of MeasuredGameThreadMs */
+	static constexpr float gameThreadSmoothing{ 0.2f };
+
+	FFSSpawnBudgetState State;
+
+	/** Samples the previous frame's game thread time into State */
+	void MeasureGameThread();
+
+	/** Pushes State to the stat group and the Insights counters */
+	void PublishState() const;
+};
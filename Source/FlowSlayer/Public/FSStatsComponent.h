@@ -0,0 +1,94 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UpgradeData.h"
+#include "FSStatsComponent.generated.h"
+
+/** Broadcasted after the aggregated value of a stat changed */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnStatChanged, EUpgradeStat);
+
+/**
+ * Aggregated value of all the modifiers of one stat.
+ * Final stat = (Base + Additive) * Multiplier — each consumer keeps its own base value and clamp.
+ */
+struct FStatAggregate
+{
+	/** Sum of all additive modifiers */
+	float Additive{ 0.f };
+
+	/** Product of all multiplicative modifiers */
+	float Multiplier{ 1.f };
+
+	/** Applies the aggregate to a base value */
+	float Apply(float BaseValue) const { return (BaseValue + Additive) * Multiplier; }
+
+	/** No modifier — returned for actors without a stats component */
+	static const FStatAggregate Identity;
+};
+
+/** Single entry of a stat modifier stack */
+struct FStatModifier
+{
+	/** Who owns this modifier — setting a modifier with the same source replaces it (tier replacement) */
+	FName Source{ NAME_None };
+
+	EUpgradeValueType ValueType{ EUpgradeValueType::Additive };
+
+	float Value{ 0.f };
+};
+
+/**
+ * Central stat modifier stacks of the player.
+ * Upgrades and weapon parts push one modifier per source; the aggregate of a stat is recomputed
+ * from its stack once per change, so tier replacement never accumulates floating-point drift.
+ * Consumers cache a pointer to the aggregate (stable for the lifetime of the component) and read it when needed.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class FLOWSLAYER_API UFSStatsComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	UFSStatsComponent();
+
+	/** Adds the modifier, or replaces the one already owned by Source on that stat */
+	void SetModifier(EUpgradeStat Stat, FName Source, EUpgradeValueType ValueType, float Value);
+
+	/** Removes the modifier owned by Source on that stat (no-op if none) */
+	void RemoveModifier(EUpgradeStat Stat, FName Source);
+
+	/** Returns a stable pointer to the aggregate of a stat — Identity for None */
+	const FStatAggregate* GetAggregate(EUpgradeStat Stat) const;
+
+	/** Returns BaseValue with all the modifiers of Stat applied */
+	UFUNCTION(BlueprintPure, Category = "Stats")
+	float GetStatValue(EUpgradeStat Stat, float BaseValue) const { return GetAggregate(Stat)->Apply(BaseValue); }
+
+	/**
+	 * Returns the aggregate of a stat on the given actor's stats component,
+	 * or FStatAggregate::Identity if the actor has none (e.g. enemies sharing a player component class).
+	 */
+	static const FStatAggregate* FindAggregate(const AActor* Actor, EUpgradeStat Stat);
+
+	/** Broadcasted once per stat whose aggregate changed */
+	FOnStatChanged OnStatChanged;
+
+private:
+
+	static constexpr int32 StatCount{ static_cast<int32>(EUpgradeStat::Count) };
+
+	/** Modifier stack of each stat, indexed by EUpgradeStat */
+	TArray<FStatModifier> Modifiers[StatCount];
+
+	/** Cached aggregate of each stat, indexed by EUpgradeStat — never reallocated, pointers handed out stay valid */
+	FStatAggregate Aggregates[StatCount];
+
+	/** One bit per stat whose stack changed since the last recompute */
+	uint32 DirtyStats{ 0 };
+
+	static_assert(StatCount <= 32, "DirtyStats holds one bit per EUpgradeStat");
+
+	/** Recomputes the aggregate of every dirty stat and broadcasts OnStatChanged for each */
+	void RecomputeDirtyStats();
+};
@@ -11,6 +11,7 @@
 #include "NiagaraFunctionLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "WeaponPartData.h"
+#include "FSStatsComponent.h"
 #include "FSWeapon.generated.h"
 
 class UBoxComponent;
@@ -31,6 +32,20 @@ public:
     /** Trail component attached at weapon tip socket */
     UNiagaraComponent* GetTrailNiagaraTipComponent() const { return TrailNiagaraTipComponent; }
 
+    /**
+     * Sets a trail system on both trail components.
+     * No-op when the system is already set — SetAsset reinitializes the Niagara instances, so it must not run per swing.
+     */
+    void BindTrailSystem(UNiagaraSystem* TrailSystem);
+
+    /**
+     * Starts or stops the trail. Starting binds the blade tier's system, or NotifyTrailSystem when the tier table has none
+     * (no-op if already set). A system exposing TrailEmitParameter stays active: a swing only flips the parameter and
+     * hands a fresh TrailRibbonIDParameter, so the ribbon neither reinitializes nor connects to the previous swing.
+     * A system without it falls back to restarting the components per swing (Activate(true) / Deactivate()).
+     */
+    void SetTrailActive(bool bActive, UNiagaraSystem* NotifyTrailSystem = nullptr);
+
     FName GetBaseSocketName() const { return BaseSocket; }
     FName GetTipSocketName() const { return TipSocket; }
 
@@ -38,9 +53,8 @@ public:
     FVector GetTipSocketLocation() const { return WeaponMesh->GetSocketLocation(TipSocket); }
 
     /**
-     * Equips a weapon part and applies its stat to the weapon's cached multipliers.
-     * If this slot already has a part, the previous tier's effect is first undone,
-     * then the new part's effect is applied.
+     * Equips a weapon part and sets its stat modifier on the owner's stats component.
+     * Each slot owns one modifier source, so a new tier replaces the previous one.
      */
     void EquipPart(EWeaponPartType PartType, const FWeaponPartData& PartData);
 
@@ -48,12 +62,10 @@ public:
     UFUNCTION(BlueprintPure, Category = "WeaponParts")
     int32 GetCurrentTier(EWeaponPartType PartType) const;
 
-    /** Returns the cumulative damage multiplier contributed by all equipped weapon parts */
-    UFUNCTION(BlueprintPure, Category = "WeaponParts")
-    float GetDamageMultiplier() const { return WeaponDamageMultiplier; }
-
 protected:
 
+    virtual void BeginPlay() override;
+
     /** Root component for the weapon actor */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     USceneComponent* RootComp;
@@ -70,6 +82,22 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UNiagaraComponent* TrailNiagaraTipComponent{ nullptr };
 
+    /**
+     * Trail system per blade tier — index 0 is the bare weapon, index N the blade part T(N).
+     * Missing tiers fall back to the highest tier below; bound on BeginPlay and when a blade part is equipped.
+     * Leave empty to use the system of each WeaponTrail notify instead.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "VFX")
+    TArray<UNiagaraSystem*> TrailSystemsByBladeTier;
+
+    /** Bool user parameter gating the trail emitter's spawn — the trail systems should expose it */
+    UPROPERTY(EditDefaultsOnly, Category = "VFX")
+    FName TrailEmitParameter{ "User.TrailEmit" };
+
+    /** Int user parameter bound to the ribbon ID — a new value per swing starts a separate ribbon */
+    UPROPERTY(EditDefaultsOnly, Category = "VFX")
+    FName TrailRibbonIDParameter{ "User.TrailRibbonID" };
+
     /** Socket name at the base of the weapon where the hitbox starts */
     UPROPERTY(EditDefaultsOnly, Category = "Sockets")
     FName BaseSocket{ "S_WeaponBase" };
@@ -92,18 +120,33 @@ private:
 
     /**
      * Maps each weapon slot to the FWeaponPartData of the currently equipped tier.
-     * Retained so EquipPart() can reverse the previous tier's stat before applying the new one.
+     * Retained so EquipPart() can drop the previous tier's modifier when the new tier targets another stat.
      * Must be UPROPERTY — FWeaponPartData contains a UTexture2D* that GC must track.
      */
     UPROPERTY()
     TMap<EWeaponPartType, FWeaponPartData> EquippedPartDataCache;
 
-    /** Cumulative damage multiplier from all equipped weapon parts — starts at 1.0 (no contribution) */
-    float WeaponDamageMultiplier{ 1.f };
+    /** Trail system currently set on both trail components */
+    UPROPERTY()
+    UNiagaraSystem* BoundTrailSystem{ nullptr };
+
+    /** System of the equipped blade tier — nullptr when the tier table has none */
+    UPROPERTY()
+    UNiagaraSystem* TierTrailSystem{ nullptr };
+
+    /** True when BoundTrailSystem exposes TrailEmitParameter — its components stay active between swings */
+    bool bTrailEmitGated{ false };
+
+    /** Ribbon ID of the current swing */
+    int32 TrailRibbonID{ 0 };
 
-    /** Applies a weapon part's stat to the appropriate multiplier — also used to reverse a previous tier */
-    void ApplyPartStat(const FWeaponPartData& PartData);
+    /** Resolves and binds the trail system of the equipped blade tier, if the tier table has one */
+    void RefreshTrailSystem();
+
+    /** Owner's stats component — receives one modifier per equipped slot, cached on BeginPlay */
+    UPROPERTY()
+    UFSStatsComponent* OwnerStats{ nullptr };
 
-    /** Builds a reversed copy of PartData (negates additive, inverts multiplicative) for the undo step */
-    FWeaponPartData BuildReversePart(const FWeaponPartData& PartData) const;
+    /** Modifier source of a slot on the stats component (e.g. WeaponPart.Blade) */
+    static FName GetPartModifierSource(EWeaponPartType PartType);
 };
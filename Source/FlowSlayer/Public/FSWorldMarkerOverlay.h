@@ -0,0 +1,78 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "FSWorldMarkerOverlay.generated.h"
+
+class UCanvasPanel;
+class UFSWorldMarkerWidget;
+class UFSWorldMarkerSubsystem;
+
+/**
+ * HUD layer drawing every world-anchored UI element (enemy health bars, lock-on indicator, chest prompt).
+ * Once per frame: reads the requested markers from UFSWorldMarkerSubsystem, builds the view-projection matrix once,
+ * projects all anchors in one pass, culls the off-screen ones and assigns the rest to a pool of UFSWorldMarkerWidget.
+ *
+ * Markers are moved through their render translation — their canvas slot never changes, so the canvas layout is
+ * never invalidated by movement and the overlay can sit inside an InvalidationBox. Unused pooled markers are collapsed,
+ * so prepass and paint only cost the markers actually on screen.
+ *
+ * Created by AFlowSlayerCharacter below the main HUD. The Blueprint subclass only needs a CanvasPanel named MarkerCanvas.
+ */
+UCLASS(Abstract)
+class FLOWSLAYER_API UFSWorldMarkerOverlay : public UUserWidget
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void NativeConstruct() override;
+
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+	/** Full-screen canvas the markers are added to */
+	UPROPERTY(meta = (BindWidget))
+	UCanvasPanel* MarkerCanvas{ nullptr };
+
+	/** Marker widget class instanced by the pool */
+	UPROPERTY(EditDefaultsOnly, Category = "Markers")
+	TSubclassOf<UFSWorldMarkerWidget> MarkerClass;
+
+	/** Markers created up front — the pool grows past it if more enemies need a marker at once */
+	UPROPERTY(EditDefaultsOnly, Category = "Markers", meta = (ClampMin = "0"))
+	int32 InitialPoolSize{ 8 };
+
+	/** Anchors projected this far outside the view (in pixels) are still drawn, so markers slide out instead of popping */
+	UPROPERTY(EditDefaultsOnly, Category = "Markers", meta = (ClampMin = "0.0"))
+	float CullMargin{ 64.f };
+
+private:
+
+	/** Marker source, cached on construct */
+	UPROPERTY()
+	UFSWorldMarkerSubsystem* MarkerSubsystem{ nullptr };
+
+	/** Pooled markers — the first ShownCount are in use this frame */
+	UPROPERTY()
+	TArray<UFSWorldMarkerWidget*> MarkerPool;
+
+	/** Number of pooled markers shown on the last frame */
+	int32 ShownCount{ 0 };
+
+	/** View-projection of the owning player, rebuilt once per frame */
+	FMatrix ViewProjectionMatrix{ FMatrix::Identity };
+
+	/** Constrained view rectangle of the owning player, in viewport pixels */
+	FIntRect ViewRect;
+
+	/** Caches the view-projection matrix and view rect of this frame — returns false if there is no view yet */
+	bool CacheViewProjection();
+
+	/** Projects every requested marker and lays out the pool */
+	void UpdateMarkers();
+
+	/** Returns the pooled marker at the given index, creating it if the pool is too small, and makes it visible */
+	UFSWorldMarkerWidget* AcquireMarker(int32 PoolIndex);
+
+	/** Creates a hidden marker and adds it to the canvas */
+	UFSWorldMarkerWidget* CreateMarker();
+};
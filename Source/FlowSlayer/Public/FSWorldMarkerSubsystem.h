@@ -0,0 +1,91 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "FSWorldMarkerSubsystem.generated.h"
+
+class UHealthComponent;
+
+/** Screen markers requested for one world actor */
+struct FFSWorldMarker
+{
+	/** Actor the marker follows */
+	TWeakObjectPtr<AActor> Target;
+
+	/** Identity of Target — still valid as a map key once the actor is gone */
+	TObjectKey<AActor> TargetKey;
+
+	/** Health source of the health bar (null if the target has no health component) */
+	TWeakObjectPtr<UHealthComponent> Health;
+
+	/** Height above the actor location where the marker is anchored */
+	float AnchorHeight{ 0.f };
+
+	/** Whether the health bar is requested */
+	bool bHealthBarVisible{ false };
+
+	/** Whether the lock-on marker is requested */
+	bool bLockOnVisible{ false };
+
+	/** Whether the interaction prompt is requested (e.g. reward chest key) */
+	bool bInteractPromptVisible{ false };
+
+	/** Returns true if any part of the marker is requested */
+	bool IsAnyVisible() const { return bHealthBarVisible || bLockOnVisible || bInteractPromptVisible; }
+};
+
+/**
+ * Per-world list of the actors that currently need a screen marker (health bar, lock-on indicator, interaction prompt).
+ * Gameplay code only toggles requests here — UFSWorldMarkerOverlay reads the list once per frame,
+ * projects every anchor and draws them from a pooled widget set.
+ *
+ * Actors without any visible marker are not in the list, so hidden enemies cost nothing.
+ */
+UCLASS()
+class FLOWSLAYER_API UFSWorldMarkerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Requests or releases the health bar of the given actor */
+	void SetHealthBarVisible(AActor* Target, bool bVisible);
+
+	/** Requests or releases the lock-on marker of the given actor */
+	void SetLockOnMarkerVisible(AActor* Target, bool bVisible);
+
+	/** Requests or releases the interaction prompt of the given actor */
+	void SetInteractPromptVisible(AActor* Target, bool bVisible);
+
+	/** Drops every marker of the given actor (e.g. on EndPlay) */
+	void RemoveTarget(AActor* Target);
+
+	/** Returns every actor with at least one visible marker — unordered */
+	const TArray<FFSWorldMarker>& GetMarkers() const { return Markers; }
+
+private:
+
+	/** Extra height above the capsule / bounds top, so the marker does not overlap the actor */
+	static constexpr float AnchorPadding{ 20.f };
+
+	/** Sets one visibility flag of the given actor's marker, adding or removing the marker as needed */
+	void SetMarkerFlag(AActor* Target, bool FFSWorldMarker::* Flag, bool bVisible);
+
+	/** Returns the anchor height of an actor: capsule top for characters, bounds top otherwise */
+	static float ComputeAnchorHeight(const AActor* Target);
+
+	/** Active markers — swap-removed, order is not stable */
+	TArray<FFSWorldMarker> Markers;
+
+	/** Target → index in Markers */
+	TMap<TObjectKey<AActor>, int32> MarkerIndexByTarget;
+
+	/** Returns the marker of the given actor, creating it if needed */
+	FFSWorldMarker& FindOrAddMarker(AActor* Target);
+
+	/** Removes the marker at the given index if nothing is visible anymore */
+	void RemoveIfHidden(int32 MarkerIndex);
+
+	/** Swap-removes the marker at the given index and fixes the moved entry's index */
+	void RemoveAt(int32 MarkerIndex);
+};
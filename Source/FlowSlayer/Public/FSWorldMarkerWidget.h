@@ -0,0 +1,67 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "FSWorldMarkerWidget.generated.h"
+
+class UProgressBar;
+struct FFSWorldMarker;
+
+/**
+ * One pooled screen marker: health bar, lock-on indicator and interaction prompt of a single actor.
+ * Owned and positioned by UFSWorldMarkerOverlay — a marker is reassigned to another actor whenever the pool is reshuffled.
+ *
+ * The Blueprint subclass provides the visuals by naming its widgets HealthBar / LockOnIcon / InteractPrompt (all optional).
+ * Positioned through its render translation only, so moving a marker never invalidates the overlay layout.
+ */
+UCLASS(Abstract)
+class FLOWSLAYER_API UFSWorldMarkerWidget : public UUserWidget
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Applies the state of a marker — each widget property is only touched when its value changed */
+	void SetMarkerState(const FFSWorldMarker& Marker);
+
+	/** Clears the owning actor when the marker goes back to the pool */
+	void ResetMarkerState();
+
+	/** Returns the actor this marker currently follows */
+	AActor* GetOwningActor() const { return OwningActor; }
+
+protected:
+
+	/** Health bar fill — optional */
+	UPROPERTY(meta = (BindWidgetOptional))
+	UProgressBar* HealthBar{ nullptr };
+
+	/** Lock-on indicator — optional */
+	UPROPERTY(meta = (BindWidgetOptional))
+	UWidget* LockOnIcon{ nullptr };
+
+	/** Interaction prompt (e.g. chest key) — optional */
+	UPROPERTY(meta = (BindWidgetOptional))
+	UWidget* InteractPrompt{ nullptr };
+
+	/** Actor this marker currently follows — available to Blueprint bindings */
+	UPROPERTY(BlueprintReadOnly, Category = "Marker")
+	AActor* OwningActor{ nullptr };
+
+	/** Called when the marker is reassigned to another actor (extra visuals that depend on the target, e.g. elite icon) */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Marker")
+	void OnOwningActorChanged(AActor* NewOwningActor);
+
+private:
+
+	/** Last values pushed to the widgets */
+	float LastHealthRatio{ -1.f };
+	bool bHealthBarShown{ true };
+	bool bLockOnShown{ true };
+	bool bInteractPromptShown{ true };
+
+	/** Shows or collapses an optional part, only if its state changed */
+	static void SetPartVisible(UWidget* Part, bool& bShown, bool bVisible);
+
+	/** Switches the owning actor and notifies Blueprint */
+	void SetOwningActor(AActor* NewOwningActor);
+};
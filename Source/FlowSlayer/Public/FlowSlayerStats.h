@@ -0,0 +1,114 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/**
+ * Gameplay profiling markers of the FlowSlayer module.
+ *
+ * In game: "stat FlowSlayer" shows the cycle counters and the per-frame counters.
+ * In Unreal Insights: every FS_SCOPE_CYCLE_COUNTER also emits a CPU event on FlowSlayerChannel,
+ * so a headless capture only needs that channel (plus frame) to be diffable between builds:
+ *   -nullrhi -unattended -trace=frame,FlowSlayer,stats -tracefile=<path>.utrace
+ *
+ * Memory: allocations of each gameplay subsystem are tagged under "FlowSlayer/..." in LLM —
+ * run with -llm (and -llmcsv for a per-tag CSV) and check "stat LLMFULL".
+ */
+
+DECLARE_STATS_GROUP(TEXT("FlowSlayer"), STATGROUP_FlowSlayer, STATCAT_Advanced);
+
+/** Trace channel of the gameplay CPU events — enable with -trace=FlowSlayer */
+UE_TRACE_CHANNEL_EXTERN(FlowSlayerChannel, FLOWSLAYER_API);
+
+// ==================== CYCLE COUNTERS ====================
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitbox ActiveFrameStarted"), STAT_FS_HitboxActiveFrameStarted, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Hitbox ProcessHits"), STAT_FS_HitboxProcessHits, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat HandleOnHitLanded"), STAT_FS_CombatHandleOnHitLanded, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy HandleOnHitLanded"), STAT_FS_EnemyHandleOnHitLanded, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LockOn EngageLockOn"), STAT_FS_LockOnEngage, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Arena TrySpawnEnemy"), STAT_FS_ArenaTrySpawnEnemy, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI FollowPlayer"), STAT_FS_AIFollowPlayer, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HitFeedback OnLandHit"), STAT_FS_HitFeedbackOnLandHit, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Progression DrawMixedRewards"), STAT_FS_ProgressionDrawMixedRewards, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("WorldMarker Update"), STAT_FS_WorldMarkerUpdate, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Flush"), STAT_FS_HUDFlush, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Update"), STAT_FS_EnemyUpdate, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Update Compute (parallel)"), STAT_FS_EnemyUpdateCompute, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Update Apply"), STAT_FS_EnemyUpdateApply, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Weapon SetTrailActive"), STAT_FS_WeaponSetTrailActive, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dash Move"), STAT_FS_DashMove, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+
+// ==================== LLM TAGS ====================
+
+LLM_DECLARE_TAG_API(FlowSlayer, FLOWSLAYER_API);
+LLM_DECLARE_TAG_API(FlowSlayer_Enemies, FLOWSLAYER_API);
+LLM_DECLARE_TAG_API(FlowSlayer_Projectiles, FLOWSLAYER_API);
+LLM_DECLARE_TAG_API(FlowSlayer_CombatData, FLOWSLAYER_API);
+LLM_DECLARE_TAG_API(FlowSlayer_UI, FLOWSLAYER_API);
+LLM_DECLARE_TAG_API(FlowSlayer_VFX, FLOWSLAYER_API);
+
+// ==================== COUNTERS (reset every frame) ====================
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Scene Queries"), STAT_FS_SceneQueries, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Async Scene Queries"), STAT_FS_AsyncSceneQueries, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits Processed"), STAT_FS_HitsProcessed, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Timers Created"), STAT_FS_TimersCreated, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Spawns"), STAT_FS_Spawns, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Delegate Broadcasts"), STAT_FS_DelegateBroadcasts, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+
+// ==================== GAUGES (kept across frames) ====================
+
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Frame Cost (ms)"), STAT_FS_SpawnFrameCostMs, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Difficulty"), STAT_FS_SpawnDifficulty, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Spawn Difficulty Target"), STAT_FS_SpawnDifficultyTarget, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemies Reduced Movement"), STAT_FS_ReducedMovementEnemies, STATGROUP_FlowSlayer, FLOWSLAYER_API);
+
+// ==================== FRAME COUNTERS ====================
+
+/** Frame counters are mirrored outside the stats system in every non-shipping build (stats may be compiled out) */
+#define FS_WITH_FRAME_COUNTERS !UE_BUILD_SHIPPING
+
+/**
+ * Plain copy of the FlowSlayer counters for the current frame.
+ * Readable without "stat FlowSlayer" — UFSPerfGateSubsystem samples and resets it every frame.
+ * Game thread only.
+ */
+struct FLOWSLAYER_API FFlowSlayerFrameCounters
+{
+	uint32 SceneQueries{ 0 };
+	uint32 AsyncSceneQueries{ 0 };
+	uint32 HitsProcessed{ 0 };
+	uint32 TimersCreated{ 0 };
+	uint32 Spawns{ 0 };
+	uint32 DelegateBroadcasts{ 0 };
+
+	/** Returns the counters of the running process */
+	static FFlowSlayerFrameCounters& Get();
+
+	/** Zeroes every counter — called once per sampled frame */
+	void Reset() { *this = FFlowSlayerFrameCounters{}; }
+};
+
+// ==================== MACROS ====================
+
+/** Cycle counter + Insights CPU event on FlowSlayerChannel for the enclosing scope */
+#define FS_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, FlowSlayerChannel)
+
+#if FS_WITH_FRAME_COUNTERS
+#define FS_FRAME_COUNTER_ADD(Name, Amount) FFlowSlayerFrameCounters::Get().Name += (Amount)
+#else
+#define FS_FRAME_COUNTER_ADD(Name, Amount)
+#endif
+
+/** Increments a FlowSlayer counter by one — Name is the STAT_FS_ counter without its prefix (e.g. SceneQueries) */
+#define FS_INC_COUNTER(Name) FS_INC_COUNTER_BY(Name, 1)
+
+/** Increments a FlowSlayer counter by Amount */
+#define FS_INC_COUNTER_BY(Name, Amount) \
+	INC_DWORD_STAT_BY(STAT_FS_##Name, Amount); \
+	FS_FRAME_COUNTER_ADD(Name, Amount)
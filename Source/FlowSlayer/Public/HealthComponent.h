@@ -1,9 +1,8 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
-#include "Components/WidgetComponent.h"
 #include "GameFramework/Character.h"
-#include "UpgradeData.h"
+#include "FSStatsComponent.h"
 #include "HealthComponent.generated.h"
 
 DECLARE_DELEGATE(FOnDeath);
@@ -26,29 +25,29 @@ public:
 	float GetCurrentHealth() const { return CurrentHealth; }
 
 	UFUNCTION(BlueprintPure)
-	float GetMaxHealth() const { return MaxHealth; }
+	float GetMaxHealth() const { return CurrentMaxHealth; }
 
 	UFUNCTION(BlueprintPure)
-	float GetHealthRatio() const { return CurrentHealth / MaxHealth; }
+	float GetHealthRatio() const { return CurrentHealth / CurrentMaxHealth; }
 
 	UFUNCTION(BlueprintPure)
 	bool IsHealOnCooldown() const { return bIsHealOnCooldown; }
 
 	/** Returns the flow cost required to use the heal skill */
-	float GetHealFlowCost() const { return HealFlowCost; }
+	float GetHealFlowCost() const { return FMath::Max(0.f, HealFlowCostStat->Apply(HealFlowCost)); }
 
-	void DisplayLifeBar(bool bDisplay) { LifeBarWidget->SetVisibility(bDisplay); }
+	/** Requests or releases the owner's world health bar (drawn by UFSWorldMarkerOverlay) — no-op if bShowWorldHealthBar is false */
+	void DisplayLifeBar(bool bDisplay);
 
 	void ReceiveDamage(float damageAmount, AActor* instigator);
 
+	/** Toggles bInvincibility — debug / perf scenarios only */
+	void SetInvincibility(bool bEnabled) { bInvincibility = bEnabled; }
+
 	/** Heal the owner to {MaxHealth} and plays heal animation */
 	UFUNCTION(BlueprintCallable)
 	void Heal();
 
-	/** Applies upgrade effects that concern the health system (MaxHealth, HealCooldown, HealFlowCost stats) */
-	UFUNCTION()
-	void HandleOnUpgradeSelected(const FUpgradeData& Upgrade);
-
 	/** Executed when owning actor dies */
 	FOnDeath OnDeath;
 
@@ -65,9 +64,11 @@ protected:
 
 	virtual void BeginPlay() override;
 
-	/** Life bar widget ui */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Health | UI")
-	UWidgetComponent* LifeBarWidget{ nullptr };
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Whether the owner gets a world health bar above its head when damaged (enemies) — the player's health lives in the HUD */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Health | UI")
+	bool bShowWorldHealthBar{ true };
 
 	/*
 	* Make the player not take any damage
@@ -91,17 +92,23 @@ protected:
 	/** Track state of heal cooldown */
 	bool bIsHealOnCooldown{ false };
 
-	/** Maximum health of the owner */
+	/** Base maximum health of the owner — MaxHealth stat applies on top */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Health", meta = (ClampMin = "1.0"))
 	float MaxHealth{ 100.f };
 
 private:
 
-	/** Current health of the owner — clamped to [0, MaxHealth] */
+	/** Maximum health with the MaxHealth stat applied — refreshed when the stat changes */
+	float CurrentMaxHealth{ MaxHealth };
+
+	/** Current health of the owner — clamped to [0, CurrentMaxHealth] */
 	float CurrentHealth{ MaxHealth };
 
-	/* Initialize directly the blueprint variable "OwningEnemy" from this method
-	* Used for now because there's no way to directly a direct reference to FSEnemy in widget blueprint
-	*/
-	void InitializeLifeBarWidgetRef();
+	/** Stats cached from the owner's stats component on BeginPlay (Identity for actors without one, e.g. enemies) */
+	const FStatAggregate* MaxHealthStat{ &FStatAggregate::Identity };
+	const FStatAggregate* HealCooldownStat{ &FStatAggregate::Identity };
+	const FStatAggregate* HealFlowCostStat{ &FStatAggregate::Identity };
+
+	/** Bound to UFSStatsComponent::OnStatChanged — refreshes CurrentMaxHealth and heals the gained HP */
+	void HandleOnStatChanged(EUpgradeStat Stat);
 };
@@ -31,6 +31,9 @@ public:
     /** Called on the VICTIM's component when they receive a hit. Applies owner-side effects (knockback, hitstop, hit shake, hit flash) */
     void OnReceiveHit(const FVector& attackerLocation, float knockbackForce = 0.f, float upKnockbackForce = 0.f);
 
+    /** Appends the soft assets this component needs resident (hit VFX) — used by preload manifests */
+    void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
 protected:
 
 	virtual void BeginPlay() override;
@@ -100,11 +103,13 @@ private:
 
     // === HIT VFX ===
 
-    /** Pool of Niagara systems to pick from randomly on hit */
+    /** Pool of Niagara systems to pick from randomly on hit
+    * Soft references — streamed in by the owner's preload (combat component or arena manifest)
+    */
     UPROPERTY(EditDefaultsOnly, Category = "HitVFX", meta = (AllowPrivateAccess = "true"))
-    TArray<UNiagaraSystem*> HitParticlesSystemArray;
+    TArray<TSoftObjectPtr<UNiagaraSystem>> HitParticlesSystemArray;
 
-    /** Spawns a random hit VFX at the given world location */
+    /** Spawns a random hit VFX at the given world location — skipped if the picked system is not resident yet */
     void SpawnHitVFX(const FVector& location);
 
     // === SFX ===
@@ -1,9 +1,16 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "CollisionShape.h"
 #include "FSWeapon.h"
 #include "HitboxComponent.generated.h"
 
+struct FOverlapResult;
+struct FFSHitboxTimeline;
+class UAnimInstance;
+class UAnimMontage;
+class UFSHitboxTimelineSubsystem;
+
 UENUM(BlueprintType)
 enum class EHitboxShape : uint8
 {
@@ -45,10 +52,6 @@ struct FHitboxProfile
 
 DECLARE_DELEGATE_TwoParams(FOnHitboxHitLanded, AActor* hitActor, const FVector& hitLocation);
 
-/** Delegates used to activate and deactivate damage hitbox */
-DECLARE_DELEGATE_OneParam(FOnActiveFrameStarted, const FHitboxProfile* hitboxProfile);
-DECLARE_DELEGATE(FOnActiveFrameStopped);
-
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class FLOWSLAYER_API UHitboxComponent : public UActorComponent
 {
@@ -58,12 +61,6 @@ public:
 
 	UHitboxComponent();
 
-    /** Event delegates notify state
-    * Notified during a MELEE attack Animation
-    */
-    FOnActiveFrameStarted OnActiveFrameStarted;
-    FOnActiveFrameStopped OnActiveFrameStopped;
-
     /** Broadcasted when a target is hit inside the hitbox */
     FOnHitboxHitLanded OnHitboxHitLanded;
 
@@ -76,10 +73,25 @@ public:
 
     void SetOwnerWeaponRef(AFSWeapon* weaponRef) { OwnerWeapon = weaponRef; }
 
+    /** Starts evaluating the hitbox timeline of a montage the owner just started playing
+    * Ticks until the montage stops playing or StopTimeline is called — no-op if the montage has no hitbox window
+    */
+    void StartTimeline(UAnimMontage* montage);
+
+    /** Closes the open windows and stops evaluating the current timeline */
+    void StopTimeline();
+
+    /** Contact point of an overlap, computed from the hitbox shape and the target's collision (capsule solved analytically)
+    * Overlap queries carry no impact point — this stands in for FHitResult::ImpactPoint
+    */
+    static FVector ComputeImpactPoint(const FOverlapResult& overlap, const FVector& center, const FQuat& rotation, const FCollisionShape& shape);
+
 protected:
 
 	virtual void BeginPlay() override;
 
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 private:
 
     /* Owner weapon reference 
@@ -89,16 +101,46 @@ private:
     UPROPERTY()
     AFSWeapon* OwnerWeapon{ nullptr };
 
-    /** Activate the weapon hitbox and enable collision detection
-    * Called via AnimNotify during attack animations
-    * Enables tick, initializes sweep starting position, and activates sword trail VFX
+    /** Owner mesh — its montage position drives the timeline, and it ticks before this component */
+    UPROPERTY()
+    USkeletalMeshComponent* OwnerMesh{ nullptr };
+
+    UPROPERTY()
+    UFSHitboxTimelineSubsystem* TimelineSubsystem{ nullptr };
+
+    /** Montage whose timeline is evaluated — nullptr when idle */
+    UPROPERTY()
+    UAnimMontage* PlayingMontage{ nullptr };
+
+    /** Compiled windows of PlayingMontage */
+    TSharedPtr<const FFSHitboxTimeline> PlayingTimeline;
+
+    /** Windows open last evaluation (bit = window index) */
+    TBitArray<> OpenWindows;
+
+    /** Montage position of the last evaluation */
+    float LastMontagePosition{ 0.f };
+
+    /** Montage section of the last evaluation */
+    FName LastMontageSection{ NAME_None };
+
+    /** Slack on the advance a frame can play (DeltaTime * play rate) before the position change counts as a jump */
+    static constexpr float discontinuityTolerance{ 1.5f };
+
+    /** Opens / runs / closes the windows crossed since the last evaluation
+    * A window shorter than a frame is still run once — but a jump (section jump, loop, restart) runs nothing it skipped
     */
-    void HandleActiveFrameStarted(const FHitboxProfile* hitboxProfile);
+    void EvaluateTimeline(float DeltaTime);
 
-    /** Deactivate the weapon hitbox and disable collision detection
-    * Called via AnimNotify at the end of attack animations
-    * Disables tick, clears hit actors list, and deactivates sword trail VFX
+    /** Returns true if the montage jumped since the last evaluation instead of playing —
+    * moved backward, advanced more than DeltaTime * play rate, or changed section without playing into it
     */
+    bool IsMontageDiscontinuity(const UAnimInstance& animInstance, float position, FName section, float DeltaTime) const;
+
+    /** Runs the detection of a hitbox profile — called every frame of its window */
+    void HandleActiveFrameStarted(const FHitboxProfile* hitboxProfile);
+
+    /** Clears the hit actors list at the end of a window */
     void HandleActiveFrameStopped();
 
     /** Track actors hit during current attack to prevent multiple hits
@@ -106,13 +148,23 @@ private:
     */
     TSet<AActor*> ActorsHitThisAttack;
 
+    /** Weapon base → tip sweep — the only real sweep, every other shape is a static overlap */
     void DetectWeaponSweep(float radius, bool bShowDebugLines = false, float debugLinesDuration = 1.f);
     void DetectSphere(float range, const FVector& offset, bool bShowDebugLines = false, float debugLinesDuration = 1.f);
     void DetectCone(float range, float halfAngleDeg, const FVector& offset, bool bShowDebugLines = false, float debugLinesDuration = 1.f);
     void DetectBox(const FVector& extent, float range, const FVector& offset, bool bShowDebugLines = false, float debugLinesDuration = 1.f);
 
+    /** Overlaps the shape against pawns, ignoring the owner and its weapon */
+    bool OverlapPawns(const FVector& center, const FQuat& rotation, const FCollisionShape& shape, TArray<FOverlapResult>& outOverlaps) const;
+
     /** Process and adds valid damageable actors to ActorsHitThisAttack
     * Prevents targets from being hit multiple times during one attack
     */
     void ProcessHits(const TArray<FHitResult>& hits);
+
+    /** Same as ProcessHits for overlap queries — impact points are computed only for the actors not hit yet */
+    void ProcessOverlaps(const TArray<FOverlapResult>& overlaps, const FVector& center, const FQuat& rotation, const FCollisionShape& shape);
+
+    /** Adds the actor to ActorsHitThisAttack and broadcasts OnHitboxHitLanded if it is damageable */
+    void RegisterHit(AActor* hitActor, const FVector& impactPoint);
 };
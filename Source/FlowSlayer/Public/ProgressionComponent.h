@@ -7,13 +7,14 @@
 #include "ProgressionComponent.generated.h"
 
 class AFSWeapon;
+class UFSStatsComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnXPGained, int32, Amount, int32, NewTotal);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnLevelUp, int32, NewLevel);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMilestoneLevelUp, int32, NewLevel);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnItemDrop, const FWeaponPartData&, WeaponPartData);
 
-/** Broadcasted when the player confirms an upgrade selection — all concerned systems bind here */
+/** Broadcasted when the player confirms an upgrade selection — stat effects are already applied through UFSStatsComponent */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnUpgradeSelected, const FUpgradeData&, Upgrade);
 
 /** Broadcasted when a weapon part is selected from the reward screen — FlowSlayerCharacter binds here to forward to AFSWeapon::EquipPart() */
@@ -28,6 +29,8 @@ public:
 
 	UProgressionComponent();
 
+	virtual void BeginPlay() override;
+
 	/** Awards XP to the player — triggers level up(s) if threshold is reached */
 	void AddXP(int32 Amount);
 
@@ -49,23 +52,35 @@ public:
 	bool IsMilestoneLevel(int32 Level) const;
 
 	/**
-	 * Draws N unique upgrades at random from the available pool (excludes already active upgrades).
-	 * Called by the upgrade screen to populate the three choices shown to the player.
+	 * Draws N unique upgrades at random (weighted by DrawWeight) from the eligible pool.
+	 * Only the drawn rows are copied.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Progression|Upgrades")
 	TArray<FUpgradeData> DrawUpgrades(int32 Count = 3);
 
 	/**
 	 * Draws Count reward cards from a mixed pool of eligible upgrades and eligible weapon parts.
-	 * Replaces DrawUpgrades() at all milestone and chest call sites.
+	 * Weighted by DrawWeight, without replacement. Cards are handles — resolve them with GetCardUpgradeData / GetCardWeaponPartData.
 	 * Returns fewer than Count cards if the combined eligible pool is smaller.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Progression|Rewards")
 	TArray<FRewardCard> DrawMixedRewards(int32 Count = 3);
 
+	/** Resolves an upgrade card — returns false if the card is not a valid upgrade handle */
+	UFUNCTION(BlueprintPure, Category = "Progression|Rewards")
+	bool GetCardUpgradeData(const FRewardCard& Card, FUpgradeData& OutUpgrade) const;
+
+	/** Resolves a weapon part card — returns false if the card is not a valid weapon part handle */
+	UFUNCTION(BlueprintPure, Category = "Progression|Rewards")
+	bool GetCardWeaponPartData(const FRewardCard& Card, FWeaponPartData& OutWeaponPart) const;
+
+	/** Called by the reward screen when the player confirms a card — dispatches to the upgrade or weapon part flow */
+	UFUNCTION(BlueprintCallable, Category = "Progression|Rewards")
+	void SelectRewardCard(const FRewardCard& Card);
+
 	/**
 	 * Called by the upgrade screen when the player confirms a choice.
-	 * Stores the upgrade ID, broadcasts OnUpgradeSelected so each system can react.
+	 * Marks the upgrade active, unlocks its next tier in the eligible set and sets its modifier on the owner's stats component.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Progression|Upgrades")
 	void SelectUpgrade(const FUpgradeData& Upgrade);
@@ -110,9 +125,8 @@ public:
 	FOnMilestoneLevelUp OnMilestoneLevelUp;
 
 	/**
-	 * Broadcasted when the player confirms an upgrade selection.
-	 * CombatComponent, DashComponent, HealthComponent etc. bind here
-	 * and apply the modification if the upgrade targets their stat.
+	 * Broadcasted when the player confirms an upgrade selection, after its stat modifier was set.
+	 * Stat consumers read UFSStatsComponent instead — this is for UI and feedback.
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "Progression|Upgrades")
 	FOnUpgradeSelected OnUpgradeSelected;
@@ -151,9 +165,49 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category = "Progression|WeaponParts")
 	UDataTable* WeaponPartDataTable{ nullptr };
 
-	/** IDs of upgrades the player has selected this run — used to exclude them from future draws */
+	// ==================== REWARD INDEX ====================
+	// Built once in BeginPlay — rows are interned to integer handles (index in UpgradeRows / WeaponPartRows).
+	// Row pointers point into the DataTables, which are not modified at runtime.
+
+	/** Interned upgrade rows — index = upgrade handle */
+	TArray<const FUpgradeData*> UpgradeRows;
+
+	/** UpgradeID → upgrade handle */
+	TMap<FName, int32> UpgradeHandleByID;
+
+	/** Prerequisite handle of each upgrade (INDEX_NONE for tier 1) */
+	TArray<int32> UpgradePrerequisites;
+
+	/** Reverse prerequisite edges — upgrades unlocked when the key upgrade is selected */
+	TArray<TArray<int32>> UpgradeDependents;
+
+	/** Upgrades selected this run, indexed by handle */
+	TBitArray<> ActiveUpgrades;
+
+	/** Handles of the upgrades that can currently be drawn — updated on selection, never rebuilt */
+	TArray<int32> EligibleUpgrades;
+
+	/** Interned weapon part rows — index = weapon part handle */
+	TArray<const FWeaponPartData*> WeaponPartRows;
+
+	/** Weapon part handle per [slot][tier - 1] (INDEX_NONE if the table has no such row) */
+	int32 WeaponPartHandles[WeaponPartSlotCount][WeaponPartMaxTier];
+
+	/** Sets every weapon part handle to INDEX_NONE */
+	void ResetWeaponPartHandles();
+
+	/** Interns both DataTables and builds the prerequisite graph + initial eligible set */
+	void BuildRewardIndex();
+
+	/** Marks an upgrade active and moves its dependents into the eligible set */
+	void SelectUpgradeByHandle(int32 UpgradeHandle);
+
+	/** Returns the handle of the next tier for the given slot, INDEX_NONE if maxed out or missing */
+	int32 GetNextWeaponPartHandle(EWeaponPartType SlotType) const;
+
+	/** Owner's stats component — receives one modifier per upgrade chain, cached on BeginPlay */
 	UPROPERTY()
-	TSet<FName> ActiveUpgradeIDs;
+	UFSStatsComponent* StatsComponent{ nullptr };
 
 	/** Weak reference to the player's equipped weapon — injected by FlowSlayerCharacter after weapon spawn */
 	UPROPERTY()
@@ -165,22 +219,11 @@ private:
 	 */
 	int32 CalculateXPThreshold(int32 Level) const;
 
-	/** Returns true if the upgrade is neither already active nor tier-gated by an unmet prerequisite */
-	bool IsUpgradeEligible(const FUpgradeData* Upgrade) const;
-
-	/** Builds an upgrade that undoes the effect of the given one (negates additive, inverts multiplicative)
-	* @return Prerequisite upgrade (tier below that new upgrade) with negative effect
-	*/
-	FUpgradeData BuildReverseUpgrade(const FUpgradeData& Upgrade) const;
-
-	/** If the upgrade has an active prerequisite, broadcasts its reverse to undo the previous tier's effect */
-	void UndoPreviousTier(const FUpgradeData& Upgrade);
-
 	/**
-	 * Returns true if the given part is the next eligible tier for its slot.
-	 * Eligible = EquippedWeapon's current tier for that slot is exactly Tier - 1.
+	 * Returns the tier-1 upgrade of the chain the given upgrade belongs to.
+	 * Its ID is the modifier source, so each tier replaces the previous one on the stats component.
 	 */
-	bool IsWeaponPartEligible(const FWeaponPartData& PartData) const;
+	int32 GetChainRoot(int32 UpgradeHandle) const;
 
 	/**
 	 * Returns a pointer to the next eligible FWeaponPartData for the given slot,
@@ -3,7 +3,6 @@
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "Components/BoxComponent.h"
-#include "Components/WidgetComponent.h"
 #include "EnhancedInputComponent.h"
 #include "RewardChest.generated.h"
 
@@ -36,6 +35,8 @@ protected:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UPROPERTY(BlueprintReadOnly)
 	const APawn* PlayerRef{ nullptr };
 
@@ -53,10 +54,6 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Chest | Components")
 	UBoxComponent* OverlapZone;
 
-	/** Widget component for displaying the key UI prompt */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Chest | UI")
-	UWidgetComponent* KeyUIWidget{ nullptr };
-
 	/** Handle for when the overlap begins */
 	UFUNCTION()
 	void HandleOnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
@@ -4,6 +4,7 @@
 #include "FSArenaManager.h"
 #include "FSEnemy.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/LevelStreaming.h"
 #include "RunManager.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRunArenaCleared);
@@ -11,9 +12,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRunCompleted);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScoreChanged, int32, NewScore);
 
 /**
- * Singleton actor placed in the level.
- * Owns the ordered list of arenas and orchestrates run progression:
- * arena activation, portal reveal, and run completion events.
+ * Singleton actor placed in the persistent level.
+ * Owns the ordered list of arena sublevels and orchestrates run progression:
+ * arena streaming, arena activation, portal reveal, and run completion events.
+ *
+ * Each arena lives in its own streaming sublevel. While arena N is fought, N+1 is streamed in
+ * so the portal destination is resident; N-1 is streamed out once the player teleports.
+ * At most three arena sublevels are ever resident, whatever the arena count.
  */
 UCLASS()
 class FLOWSLAYER_API ARunManager : public AActor
@@ -26,6 +31,8 @@ public:
 
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 #if WITH_EDITOR
 	virtual void OnConstruction(const FTransform& Transform) override;
 #endif
@@ -60,11 +67,11 @@ public:
 
 	/** Returns the total number of arenas in this run */
 	UFUNCTION(BlueprintPure, Category = "Run")
-	int32 GetTotalArenas() const { return Arenas.Num(); }
+	int32 GetTotalArenas() const { return ArenaLevels.Num(); }
 
 	/** Returns true if the current arena is the last one */
 	UFUNCTION(BlueprintPure, Category = "Run")
-	bool IsLastArena() const { return CurrentArenaIndex >= Arenas.Num() - 1; }
+	bool IsLastArena() const { return CurrentArenaIndex >= ArenaLevels.Num() - 1; }
 
 	/**
 	 * Returns the elapsed run time in seconds.
@@ -81,9 +88,12 @@ protected:
 
 	// ==================== CONFIGURATION ====================
 
-	/** Ordered list of arenas for this run — assign in the editor */
+	/**
+	 * Ordered list of arena sublevels for this run — one arena (manager, zones, portal, chest) per sublevel.
+	 * Each sublevel must be listed in the persistent level's Levels window with the Blueprint streaming method.
+	 */
 	UPROPERTY(EditAnywhere, Category = "Run")
-	TArray<AFSArenaManager*> Arenas;
+	TArray<TSoftObjectPtr<UWorld>> ArenaLevels;
 
 	/** Prevent run from running and activating any ArenaManager from spawning enemies
 	* ONLY used for DEBUGGING purposes
@@ -91,6 +101,13 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Run|Debug")
 	bool bDeactivateRun{ false };
 
+	/** Logs a CSV memory snapshot of the current arena's level on each arena transition (non-shipping builds only)
+	* Lines are prefixed with [ArenaMemCSV] — grep them out of the log to get the CSV
+	* One census per arena transition, never per frame — the snapshot code is compiled out of Shipping
+	*/
+	UPROPERTY(EditAnywhere, Category = "Run|Debug")
+	bool bLogMemorySnapshots{ true };
+
 	// ==================== RUNTIME STATE ====================
 
 	/** Index of the currently active arena */
@@ -109,11 +126,42 @@ protected:
 	/** Accumulated score for this run */
 	int32 CurrentScore{ 0 };
 
+	/** Arena managers resolved from the loaded sublevels, indexed like ArenaLevels (null while unloaded) */
+	UPROPERTY(Transient)
+	TArray<AFSArenaManager*> Arenas;
+
+	/** Whether the current arena must start as soon as its sublevel registers its manager */
+	bool bPendingArenaActivation{ false };
+
+	/** Whether the CSV header of the memory snapshots was already logged */
+	bool bMemorySnapshotHeaderLogged{ false };
+
 	// ==================== INTERNAL ====================
 
 	/** Binds OnArenaCleared on the given arena and starts it */
 	void ActivateArena(AFSArenaManager* Arena);
 
+	/** Removes every binding ActivateArena added — a released arena must not be reachable from the run */
+	void DeactivateArena(AFSArenaManager* Arena);
+
+	/** Starts the current arena if it is pending and its manager has registered */
+	void TryActivateCurrentArena();
+
+	/** Returns the streaming level object of the given arena sublevel (nullptr if out of range or not in the Levels list) */
+	ULevelStreaming* GetArenaStreamingLevel(int32 ArenaIndex) const;
+
+	/**
+	 * Streams in the given arena sublevel — no-op if out of range or already requested.
+	 * @param bBlockOnLoad Forces a blocking load (only for the first arena, which the player spawns in)
+	 */
+	void RequestArenaLevel(int32 ArenaIndex, bool bBlockOnLoad = false);
+
+	/** Streams out the given arena sublevel and forgets its manager */
+	void ReleaseArenaLevel(int32 ArenaIndex);
+
+	/** Called when any arena registers — maps it to its sublevel index */
+	void HandleOnArenaRegistered(AFSArenaManager* Arena);
+
 	/** Called when the current arena broadcasts OnArenaCleared */
 	UFUNCTION()
 	void HandleOnArenaCleared();
@@ -125,4 +173,11 @@ protected:
 	/** Called when a managed enemy dies — increments score and checks if arena is cleared */
 	UFUNCTION()
 	void HandleOnEnemyDeath(AFSEnemy* deadEnemy);
+
+	/**
+	 * Logs one CSV line describing what the world holds at an arena transition:
+	 * live enemies / projectiles / widgets / Niagara components (+ those destroyed but not yet collected) and process memory.
+	 * Counts that keep growing from one arena to the next point to a leak.
+	 */
+	void LogArenaMemorySnapshot(const TCHAR* EventName);
 };
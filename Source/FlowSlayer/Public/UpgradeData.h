@@ -5,8 +5,7 @@
 
 /**
  * Identifies which character stat an upgrade modifies.
- * Used by ProgressionComponent so each system
- * can query whether an active upgrade targets its stat and apply the value accordingly.
+ * Used by UFSStatsComponent to key its modifier stacks — each system reads the aggregated value of its stats.
  */
 UENUM(BlueprintType)
 enum class EUpgradeStat : uint8
@@ -43,6 +42,9 @@ enum class EUpgradeStat : uint8
 
 	/** Multiplier applied to the flow reward gained on each hit */
 	FlowGainPerHit,
+
+	/** Number of stats — sizes per-stat arrays (UFSStatsComponent) */
+	Count UMETA(Hidden),
 };
 
 /**
@@ -63,15 +65,14 @@ enum class EUpgradeValueType : uint8
 /**
  * Data row describing a single upgrade option presented to the player at milestone level-ups.
  * Stored in a UDataTable (DT_Upgrades) — one row per upgrade.
- * ProgressionComponent holds the list of active UpgradeIDs for the current run.
- * Each system queries ProgressionComponent to check whether an upgrade affecting it is active.
+ * ProgressionComponent tracks the active upgrades of the run and pushes their values into UFSStatsComponent.
  */
 USTRUCT(BlueprintType)
 struct FUpgradeData : public FTableRowBase
 {
 	GENERATED_BODY()
 
-	/** Unique identifier for this upgrade — used as the key in ProgressionComponent's active upgrade list */
+	/** Unique identifier for this upgrade — interned by ProgressionComponent; the tier-1 ID of a chain is its stat modifier source */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FName UpgradeID;
 
@@ -106,4 +107,8 @@ struct FUpgradeData : public FTableRowBase
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FName PrerequisiteUpgradeID{ NAME_None };
+
+	/** Relative chance of this upgrade being drawn among the eligible pool (0 = never drawn) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "0.0"))
+	float DrawWeight{ 1.f };
 };
@@ -18,6 +18,12 @@ enum class EWeaponPartType : uint8
 	Gem,
 };
 
+/** Number of weapon slots — one per EWeaponPartType value, keep in sync with the last entry */
+constexpr int32 WeaponPartSlotCount{ static_cast<int32>(EWeaponPartType::Gem) + 1 };
+
+/** Highest tier a weapon part can reach (tiers are 1-based) */
+constexpr int32 WeaponPartMaxTier{ 3 };
+
 /**
  * Data row describing a single weapon part tier offered to the player.
  * Stored in DT_WeaponParts — one row per part tier (e.g. Blade_T1, Blade_T2, Blade_T3).
@@ -74,38 +80,38 @@ struct FWeaponPartData : public FTableRowBase
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FName PrerequisitePartID{ NAME_None };
+
+	/** Relative chance of this part being drawn among the eligible pool (0 = never drawn) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ClampMin = "0.0"))
+	float DrawWeight{ 1.f };
 };
 
 /** Identifies whether a reward card contains an upgrade or a weapon part */
 UENUM(BlueprintType)
 enum class ERewardType : uint8
 {
-	/** Card holds an FUpgradeData payload */
+	/** Card points into the upgrade table */
 	Upgrade,
 
-	/** Card holds an FWeaponPartData payload */
+	/** Card points into the weapon part table */
 	WeaponPart,
 };
 
 /**
- * Blueprint-friendly wrapper returned by DrawMixedRewards().
- * WBP_UpgradeScreen inspects RewardType to decide which payload fields to read and display.
- * Only one of UpgradeData / WeaponPartData is meaningful per instance — determined by RewardType.
+ * Lightweight handle returned by DrawMixedRewards() — no row data is copied.
+ * WBP_UpgradeScreen inspects RewardType, then resolves the row through
+ * UProgressionComponent::GetCardUpgradeData / GetCardWeaponPartData and confirms with SelectRewardCard.
  */
 USTRUCT(BlueprintType)
 struct FRewardCard
 {
 	GENERATED_BODY()
 
-	/** Discriminator — always read this before accessing UpgradeData or WeaponPartData */
+	/** Discriminator — tells which table RowIndex points into */
 	UPROPERTY(BlueprintReadOnly)
 	ERewardType RewardType{ ERewardType::Upgrade };
 
-	/** Valid when RewardType == ERewardType::Upgrade */
-	UPROPERTY(BlueprintReadOnly)
-	FUpgradeData UpgradeData;
-
-	/** Valid when RewardType == ERewardType::WeaponPart */
+	/** Interned row index in the owning ProgressionComponent's reward index (INDEX_NONE = invalid card) */
 	UPROPERTY(BlueprintReadOnly)
-	FWeaponPartData WeaponPartData;
+	int32 RowIndex{ INDEX_NONE };
 };